@@ -0,0 +1,143 @@
+/****************************************************************/
+/* CouplingBenchmark.h                                          */
+/* Coupling Throughput Benchmarks                               */
+/*                                                              */
+/* Times the field exchange of the neutronics and thermal       */
+/* multiapps, the copy transfer and a full coupled iteration    */
+/* on structured meshes of configurable size.                   */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "FieldExchange.h"
+
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <ostream>
+
+class MooseApp;
+class MooseMesh;
+class FEProblem;
+class ReactorFieldChannel;
+
+/**
+ * 耦合数据通路的性能基准
+ * Throughput benchmarks of the coupling data path.
+ *
+ * 每个规模建立两个与 scapn_input.i / thermal_input.i 相同布局的子问题
+ * （功率为非线性变量、温度为辅助变量），然后计时：
+ *   neutronics_copy    中子学多应用的 copy-in/copy-out (不含求解器)
+ *   thermal_copy       热工多应用的 copy-in/copy-out (不含求解器)
+ *   reactor_transfer   ReactorTransfer 的逐节点复制 (MultiAppCopyTransfer 的同等循环)
+ *   coupled_iteration  一次完整耦合迭代：两个 Fortran 求解器、变化量和 Aitken 松弛
+ * For every size two sub-problems with the layout of scapn_input.i and
+ * thermal_input.i are built (power as nonlinear, temperature as auxiliary
+ * variable) and the four paths above are timed. Every result is written as
+ * one JSON object per line.
+ */
+class CouplingBenchmark
+{
+public:
+  /// 命令行选项
+  struct Options
+  {
+    /// 目标自由度数 (每个场)
+    std::vector<dof_id_type> sizes = {10000, 100000, 1000000};
+
+    /// 每个基准的重复次数
+    unsigned int repeat = 5;
+
+    /// 交换顺序: lexicographic 和/或 dof
+    std::vector<std::string> layouts = {"lexicographic", "dof"};
+
+    /// 结果文件 (为空时写到标准输出)
+    std::string output;
+
+    /// 求解器的内迭代容差和最大内迭代次数
+    Real inner_tolerance = 1e-6;
+    unsigned int max_inner_iterations = 100;
+  };
+
+  /**
+   * 解析命令行
+   * --sizes 1e4,1e5,1e6,1e7  --repeat 5  --layouts lexicographic,dof
+   * --output bench.jsonl  --inner-tolerance 1e-6  --max-inner-iterations 100
+   */
+  static Options parseOptions(int argc, char ** argv);
+
+  CouplingBenchmark(MooseApp & app, const Options & options);
+  ~CouplingBenchmark();
+
+  /// 运行所有规模和顺序的基准
+  void run();
+
+protected:
+  /// 一个子问题及其数据交换器
+  struct SubProblem
+  {
+    std::unique_ptr<MooseMesh> mesh;
+    std::shared_ptr<FEProblem> problem;
+    std::unique_ptr<FieldExchange> power;
+    std::unique_ptr<FieldExchange> temperature;
+
+    /// 交给求解器的本进程网格维度
+    std::vector<int> kernel_dims;
+  };
+
+  /// 建立 nx*ny*nz 个节点的子问题
+  void buildSubProblem(SubProblem & sub,
+                       const std::string & name,
+                       const std::vector<int> & mesh_dims,
+                       bool lexicographic);
+
+  /// 运行一个规模和顺序的全部基准
+  void runCase(dof_id_type target_size, bool lexicographic);
+
+  /**
+   * 计时并输出一行结果
+   * @param name 基准名称
+   * @param layout 交换顺序
+   * @param dofs 每个场的全局自由度数
+   * @param body 被计时的操作
+   */
+  void measure(const std::string & name,
+               const std::string & layout,
+               dof_id_type dofs,
+               const std::function<void()> & body);
+
+  /**
+   * 多应用的 copy-in/求解/copy-out 通路
+   * @param input 从通道读取的场
+   * @param output 求解器写出并发布的场
+   * @param input_name 通道中输入场的名称
+   * @param input_mapping 输入场的缓存映射
+   * @param output_name 通道中输出场的名称
+   * @param output_ids 输出场的节点编号
+   * @param kernel 求解器 (为空时只测数据通路)
+   */
+  void exchange(FieldExchange & input,
+                FieldExchange & output,
+                const std::string & input_name,
+                const std::vector<std::size_t> & input_mapping,
+                const std::string & output_name,
+                const std::vector<dof_id_type> & output_ids,
+                const std::function<void(Real *, Real *, int)> & kernel);
+
+  /// 节点自由度的逐个复制 (与 MultiAppCopyTransfer 相同的循环)
+  void copyTransfer(SubProblem & from, SubProblem & to);
+
+  MooseApp & _app;
+  const Options _options;
+
+  /// 当前规模的场数据通道 (建在中子学子问题上)
+  ReactorFieldChannel * _channel;
+
+  /// 输出流
+  std::unique_ptr<std::ofstream> _file;
+  std::ostream * _out;
+};
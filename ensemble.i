@@ -0,0 +1,102 @@
+# 耦合算例集合: 中子学和热工多应用的每个 position 是一个算例，
+# 所有算例共用主应用网格 (use_parent_mesh，只能单进程运行)，每步的 Fortran
+# 求解批量完成。每个算例有自己的功率比例、温度反馈系数 (power_scales,
+# feedback_coefficients) 和松弛因子；功率水平和重金属质量为所有算例共用。
+# 每个算例的统计写入 ensemble_cases.csv。
+# Ensemble of coupled cases: every position of the neutronics and thermal
+# multiapps is one case, all cases share the parent mesh (use_parent_mesh, so
+# the run is serial) and their Fortran solves are batched at every step. Every
+# case has its own power scale, temperature feedback and relaxation factor.
+[Mesh]
+  [gmg]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 4
+    ny = 4
+    nz = 4
+  []
+[]
+
+[UserObjects]
+  [field_channel]
+    type = ReactorFieldChannel
+  []
+[]
+
+[MultiApps]
+  [neutronics]
+    type = NeutronicsMultiApp
+    app_type = MooseprojectsApp
+    input_files = 'lean_subapp.i'
+    positions = '0 0 0  0 0 0  0 0 0  0 0 0'
+    use_parent_mesh = true
+    mesh_dims = '5 5 5'
+    solver_threads = 4
+    power_var_name = power_density
+    temperature_var_name = temperature
+    field_channel = field_channel
+    power_scales = '1.0 1.05 0.95 1.0'
+    feedback_coefficients = '10 10 10 12'
+    execute_on = 'NEUTRONIC PRENEUTRONIC CORNEUTRONIC'
+  []
+
+  [thermal]
+    type = ThermalMultiApp
+    app_type = MooseprojectsApp
+    input_files = 'lean_subapp.i'
+    positions = '0 0 0  0 0 0  0 0 0  0 0 0'
+    use_parent_mesh = true
+    mesh_dims = '5 5 5'
+    solver_threads = 4
+    power_var_name = power_density
+    temperature_var_name = temperature
+    field_channel = field_channel
+    execute_on = 'THERMAL'
+  []
+[]
+
+[Kernels]
+  [dummy]
+    type = Diffusion
+    variable = dummy
+  []
+[]
+
+[Variables]
+  [dummy]
+  []
+[]
+
+[AuxVariables]
+  [power_density]
+  []
+  [temperature]
+  []
+[]
+
+[Problem]
+  type = FEProblem
+  solve = False
+[]
+
+[Executioner]
+  type = EnsembleExecutioner
+  calc_type = COUPLED
+  max_burn_steps = 3
+  fixed_point_max_its = 8
+  fixed_point_min_its = 2
+  relaxation_type = AITKEN
+  relaxation_factor = 0.7
+  field_channel = field_channel
+  output_interval = 3
+
+  power_level = 3000
+  heavy_metal_mass = 80
+  case_relaxation_factors = '0.7 0.7 0.7 0.5'
+  case_log = ensemble_cases.csv
+[]
+
+[Outputs]
+  console = true
+  csv = true
+[]
@@ -16,12 +16,14 @@
 #include "MultiApp.h"
 #include "MultiAppTransfer.h"
 #include "PostprocessorInterface.h"
+#include "CouplingFixedPointInterface.h"
 
    extern "C" {
      void update_burnup_step(int step, int max_steps);
+     void update_burnup_detailed(int step, int max_steps, double burnup_value, double power, double time_step);
    }
 
-class ReactorCouplingControl : public Control
+class ReactorCouplingControl : public Control, public CouplingFixedPointInterface
 {
 public:
   static InputParameters validParams();
@@ -107,8 +109,9 @@ public:
   /**
    * 更新Fortran程序中的燃耗步
    * Update burnup step in Fortran program
-   * 将当前燃耗步传递给外部Fortran程序
-   * Passes current burnup step to external Fortran program
+   * 将当前燃耗步、累积燃耗和功率传递给外部Fortran程序 (每个燃耗步调用一次)
+   * Passes the current burnup step, accumulated burnup and power to the
+   * external Fortran program (called once per burnup step)
    */
   void updateFortranBurnupStep();
   
@@ -116,18 +119,16 @@ protected:
   /// 计算类型: 1-仅中子学, 2-耦合计算
   unsigned int _calc_type;
   
-  /// 当前燃耗步
-  unsigned int _burn_step;
+  /// 当前燃耗步 (可重启数据：MOOSE 重启只恢复燃耗步与燃耗记录，
+  /// 求解器状态与耦合迭代值的完整重启仅由 BurnupExecutioner 的检查点提供)
+  /// Current burnup step (restartable). A MOOSE restart restores only the step
+  /// and burnup bookkeeping; a full restart including the solver state and the
+  /// coupling iterate is only supported by BurnupExecutioner checkpoints.
+  unsigned int & _burn_step;
   
   /// 最大燃耗步数
   const unsigned int _max_burn_steps;
   
-  /// 最大耦合迭代次数
-  const unsigned int _max_coupling_iterations;
-  
-  /// 耦合收敛容差
-  const Real _coupling_tolerance;
-  
   /// 中子学多应用程序名称
   const std::string _neutronics_app_name;
   
@@ -150,8 +151,8 @@ protected:
   const std::string _temp_conv_pp_name;
   
   /// 累积燃耗值 (MWd/tU)
-  /// Accumulated burnup value (MWd/tU)
-  std::vector<Real> _burnup_values;
+  /// Accumulated burnup value (MWd/tU, restartable)
+  std::vector<Real> & _burnup_values;
   
   /// 功率水平 (MW)
   /// Power level (MW)
@@ -161,13 +162,21 @@ protected:
   /// Time step (days)
   Real _time_step;
 
+  /// 重金属质量 (tU)
+  /// Heavy metal mass (tU)
+  const Real _heavy_metal_mass;
+
     // 固定点迭代参数
   const unsigned int _fixed_point_max_its;
   const unsigned int _fixed_point_min_its;
   const Real _fixed_point_tol;
+  const Real _fixed_point_abs_tol;
   const bool _accept_on_max_iteration;
+
+  // 每个燃耗步的 PerfGraph 计时段
+  const PerfID _step_timer;
   
-  // 添加收敛检查方法
-  bool checkConvergence();
+  // 收敛检查方法：返回最近一次耦合计算是否收敛
+  bool checkConvergence() const;
 
 }; 
\ No newline at end of file
@@ -0,0 +1,178 @@
+/****************************************************************/
+/* BurnupExecutioner.h                                          */
+/* Native Burnup Step Executioner                               */
+/*                                                              */
+/* Owns the burnup step loop, the predictor/corrector phases    */
+/* and the neutronics-thermal coupling iterations.              */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "Executioner.h"
+#include "CouplingFixedPointInterface.h"
+#include "BurnupStepController.h"
+
+#include <future>
+
+extern "C" {
+  void update_burnup_step(int step, int max_steps);
+  void update_burnup_detailed(int step, int max_steps, double burnup_value, double power, double time_step);
+}
+
+/**
+ * 燃耗步执行器
+ * Executioner that drives the burnup steps directly.
+ *
+ * 不再借用 Transient 的时间推进：每个燃耗步只执行中子学/热工多应用
+ * (第一步为 NEUTRONIC 或 CORNEUTRONIC+THERMAL，之后为 PRENEUTRONIC 预估步和
+ * CORNEUTRONIC 校正步，或耦合固定点迭代)。主问题的 TIMESTEP_END 对象
+ * (传输、后处理器) 和输出只在 output_interval / output_steps 指定的燃耗步
+ * 以及最后一步执行。
+ * Instead of borrowing Transient time, every burnup step only executes the
+ * neutronics and thermal multiapps (NEUTRONIC, or CORNEUTRONIC + THERMAL at
+ * the first step; then the PRENEUTRONIC predictor and CORNEUTRONIC corrector,
+ * or the coupled fixed-point iteration). The TIMESTEP_END objects of the
+ * parent (transfers, postprocessors) and the outputs run only at the steps
+ * selected by output_interval / output_steps and at the last step.
+ *
+ * 时间为累计燃耗天数，时间步号为燃耗步编号；默认 burnup_interval = 1 时
+ * 输出与原先 dt = 1 的 Transient 一致。
+ * Time is the elapsed depletion time in days and the time step is the burnup
+ * step; with the default burnup_interval = 1 the outputs line up with the
+ * previous dt = 1 Transient setup.
+ *
+ * adaptive_interval 打开时，下一燃耗步的步长由预估-校正差异控制
+ * (见 BurnupStepController)；extrapolation 打开时，若预估步功率与之前燃耗步的
+ * 线性/二次外推足够接近，则跳过校正步，并以外推差异作为误差估计。
+ * 两者都需要 field_channel 来读取每次求解的功率场。
+ *
+ * checkpoint_interval 打开时，每隔若干燃耗步写出一个二进制检查点 (见
+ * BurnupCheckpointWriter)，文件在后台线程写出；restart_step 从该步的检查点恢复
+ * 执行器、耦合迭代、交换的场和 Fortran 求解器状态，直接从下一燃耗步继续。
+ * With adaptive_interval the predictor-corrector discrepancy sets the length
+ * of the next interval (see BurnupStepController); with extrapolation the
+ * corrector is skipped whenever the predictor power agrees with a linear or
+ * quadratic extrapolation from earlier steps, and that agreement serves as the
+ * error estimate. Both read the power of every solve from field_channel.
+ *
+ * With checkpoint_interval a binary checkpoint (see BurnupCheckpointWriter) is
+ * written on a background thread every few steps; restart_step restores the
+ * executioner, the coupling iterate, the exchanged fields and the Fortran
+ * solver states from that step's checkpoint and continues with the next step.
+ */
+class BurnupExecutioner : public Executioner, public CouplingFixedPointInterface
+{
+public:
+  static InputParameters validParams();
+
+  BurnupExecutioner(const InputParameters & parameters);
+  virtual ~BurnupExecutioner();
+
+  virtual void init() override;
+  virtual void execute() override;
+  virtual bool lastSolveConverged() const override { return _last_solve_converged; }
+
+  /// 当前燃耗步
+  unsigned int burnupStep() const { return _burn_step; }
+
+protected:
+  /// 执行一个燃耗步的多应用计算 (burnup 为步末累积燃耗)
+  virtual bool solveBurnupStep(Real burnup);
+
+  /// 预估步之后：跳过或执行校正步，并估计本步误差
+  bool solvePredictorCorrector(Real burnup);
+
+  /// 是否在该燃耗步执行 TIMESTEP_END 对象和输出
+  bool isOutputStep(unsigned int step, bool last_step) const;
+
+  /// 把燃耗步、累积燃耗、功率和步长传给Fortran程序
+  void updateFortranBurnupStep(Real burnup, Real interval);
+
+  /// 是否已到达 end_time
+  bool reachedEndTime() const { return _end_time > 0.0 && _time >= _end_time * (1.0 - 1e-12); }
+
+  /// 写出当前燃耗步的检查点 (数据立即复制，文件在后台线程写出)
+  void writeCheckpoint();
+
+  /// 等待后台的检查点写出完成
+  void waitForCheckpoint();
+
+  /// 从燃耗步 step 的检查点恢复
+  void restoreCheckpoint(unsigned int step);
+
+  /// 是否需要每次求解后的功率场
+  bool tracksPower() const { return _adaptive_interval || _extrapolation_order > 0; }
+
+  FEProblemBase & _problem;
+
+  /// 计算类型: 1-仅中子学, 2-耦合计算
+  const unsigned int _calc_type;
+
+  /// 第一个和最后一个燃耗步
+  const unsigned int _first_burn_step;
+  const unsigned int _max_burn_steps;
+
+  /// 固定点迭代参数
+  const unsigned int _fixed_point_min_its;
+  const unsigned int _fixed_point_max_its;
+  const Real _fixed_point_rel_tol;
+  const Real _fixed_point_abs_tol;
+  const bool _accept_on_max_iteration;
+
+  /// 输出间隔与额外的输出燃耗步
+  const unsigned int _output_interval;
+  const std::vector<unsigned int> _output_steps;
+
+  /// 功率水平 (MW) 与重金属质量 (tU)
+  const Real _power_level;
+  const Real _heavy_metal_mass;
+
+  /// 燃耗结束时间 (天, 未设置时为 0)
+  const Real _end_time;
+
+  /// 自适应步长与外推设置
+  const bool _adaptive_interval;
+  const unsigned int _extrapolation_order;
+  const Real _extrapolation_tolerance;
+
+  /// 步长控制与功率外推
+  BurnupStepController _step_controller;
+
+  /// 当前燃耗步
+  unsigned int _burn_step;
+
+  /// 每个燃耗步末的累积燃耗值 (MWd/tU)
+  std::vector<Real> _burnup_values;
+
+  /// 本步的误差估计与接受的功率场
+  Real _step_error;
+  std::vector<Real> _step_power;
+
+  /// 预估步功率与外推功率
+  std::vector<Real> _predicted_power;
+  std::vector<Real> _extrapolated_power;
+
+  /// 跳过的校正步数
+  unsigned int _skipped_correctors;
+
+  /// 检查点间隔 (0 为不写)、文件名前缀与恢复的燃耗步 (0 为不恢复)
+  const unsigned int _checkpoint_interval;
+  const std::string _checkpoint_file_base;
+  const unsigned int _restart_step;
+
+  /// 后台写出的检查点
+  std::future<void> _pending_checkpoint;
+
+  /// 主问题的时间 (天)、时间步 (等于燃耗步) 与步长
+  Real & _time;
+  int & _time_step;
+  Real & _dt;
+
+  bool _last_solve_converged;
+
+  /// 每个燃耗步的 PerfGraph 计时段
+  const PerfID _step_timer;
+};
@@ -0,0 +1,143 @@
+/****************************************************************/
+/* EnsembleExecutioner.h                                        */
+/* Ensemble of Coupled Burnup Cases                             */
+/*                                                              */
+/* Runs many perturbed neutronics-thermal cases in one process: */
+/* one multiapp position per case, batched solver calls and     */
+/* separate coupling state for every case.                      */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "BurnupExecutioner.h"
+#include "FixedPointAccelerator.h"
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+
+/**
+ * 耦合算例集合的燃耗步执行器
+ * Burnup executioner for an ensemble of coupled cases.
+ *
+ * 每个算例是中子学和热工多应用中的一个 position：一次应用启动、网格生成和
+ * 多应用构造为所有算例共用。本进程上所有算例的 Fortran 求解在一次批量调用中
+ * 完成 (solver_threads 个线程)。
+ * Every case is one position of the neutronics and thermal multiapps, so app
+ * startup, mesh generation and multiapp construction are paid once. The
+ * Fortran solves of all local cases are one batched call (on solver_threads
+ * threads).
+ *
+ * 多应用打开 use_parent_mesh 时所有算例共用主应用的网格和自由度映射，每个实例
+ * 只保留自己的场缓冲区；每个进程只有主应用网格的一部分，因此这种算例集合只能
+ * 在单进程上运行 (多进程时报错)。不打开 use_parent_mesh 时每个算例有自己的
+ * 子应用网格，多进程时算例按 instance_cost_file 分配到各进程。
+ * With use_parent_mesh on the multiapps all cases share the parent mesh and
+ * DOF map and each instance only keeps its own field buffers. Every rank holds
+ * only part of the parent mesh, so such an ensemble runs on a single rank and
+ * is rejected on several. Without use_parent_mesh every case has its own
+ * sub-app mesh, and on several ranks the cases are placed by
+ * instance_cost_file.
+ *
+ * 每个算例的功率比例和温度反馈系数由中子学多应用的 power_scales 和
+ * feedback_coefficients 给出 (每个 position 一个值)。
+ * The per-case power scale and temperature feedback come from power_scales and
+ * feedback_coefficients of the neutronics multiapp, one value per position.
+ *
+ * 燃耗步对所有算例同步推进，每个算例有自己的松弛因子和加速历史，并单独判断
+ * 耦合收敛；已收敛的算例不再松弛。每个算例的统计写入 case_log。
+ * The burnup steps advance in lockstep; every case has its own relaxation
+ * factor and acceleration history and converges on its own, and converged
+ * cases are no longer relaxed. The per-case results go to case_log.
+ *
+ * Fortran 的燃耗状态 (update_burnup_detailed) 是整个进程共用的，批量调用无法
+ * 区分算例，因此所有算例使用执行器的 power_level 和 heavy_metal_mass。
+ * The Fortran burnup state (update_burnup_detailed) is process wide and the
+ * batched calls cannot tell the cases apart, so all cases share the
+ * power_level and heavy_metal_mass of the executioner.
+ *
+ * 所有进程对每个算例按相同顺序执行归约 (不拥有该算例的进程贡献空数组)，
+ * 每次迭代所有算例的变化量只需一次归约。
+ * Every rank visits every case in the same order (ranks without the case add
+ * empty slices), and the changes of all cases are reduced together.
+ */
+class EnsembleExecutioner : public BurnupExecutioner
+{
+public:
+  static InputParameters validParams();
+
+  EnsembleExecutioner(const InputParameters & parameters);
+
+  virtual void init() override;
+  virtual void execute() override;
+
+  /// 算例数
+  unsigned int numCases() const { return _cases.size(); }
+
+protected:
+  /// 一个算例的耦合状态
+  struct Case
+  {
+    /// 松弛/加速器
+    std::unique_ptr<FixedPointAccelerator> accelerator;
+
+    /// 上一次迭代与当前迭代的温度和功率 (本进程部分)
+    std::vector<Real> temperature_input;
+    std::vector<Real> power_previous;
+    std::vector<Real> temperature;
+    std::vector<Real> power;
+
+    /// JACOBI 格式中一起松弛的 (温度, 功率)
+    std::vector<Real> stacked_input;
+    std::vector<Real> stacked_output;
+
+    /// 最近一个燃耗步的统计
+    unsigned int iterations = 0;
+    bool converged = false;
+    Real temperature_change = 0.0;
+    Real power_change = 0.0;
+  };
+
+  virtual bool solveBurnupStep(Real burnup) override;
+
+  /// 所有算例同步的固定点迭代，返回是否全部收敛
+  bool solveEnsembleFixedPoint();
+
+  /**
+   * 所有算例的变化量，一次归约
+   * @param changes 返回每个算例的 (温度绝对, 温度相对, 功率绝对, 功率相对) 变化
+   */
+  void measureCaseChanges(std::vector<Real> & changes) const;
+
+  /// 通道中算例 c 的场名称
+  std::string caseFieldName(const std::string & base, unsigned int c) const;
+
+  /// 读取算例 c 的本地场 (本进程没有该算例时为空)
+  void readCaseField(const std::string & base, unsigned int c, std::vector<Real> & values) const;
+
+  /// 写回算例 c 的本地场
+  void
+  writeCaseField(const std::string & base, unsigned int c, const std::vector<Real> & values) const;
+
+  /// 写出本燃耗步每个算例的统计和平均功率 (burnup 为本步的累积燃耗；含归约，所有进程调用)
+  void writeCaseLog(Real burnup);
+
+  /// 按算例给定的参数 (为空时使用 fallback，只有一个值时所有算例相同)
+  std::vector<Real> caseValues(const std::string & name, Real fallback, unsigned int n) const;
+
+  /// 所有算例
+  std::vector<Case> _cases;
+
+  /// 多应用执行失败 (区别于未收敛)
+  bool _ensemble_failed;
+
+  /// 每个算例的统计文件 (主进程)
+  const FileName _case_log_file;
+  std::ofstream _case_log;
+
+  /// 开始时间 (用于吞吐量)
+  std::chrono::steady_clock::time_point _start;
+};
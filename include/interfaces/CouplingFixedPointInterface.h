@@ -0,0 +1,285 @@
+/****************************************************************/
+/* CouplingFixedPointInterface.h                                */
+/* Fixed-Point Engine for Neutronics-Thermal Coupling           */
+/*                                                              */
+/* Shared by the coupling control and user object: runs the     */
+/* coupled iterations, measures the field change between        */
+/* iterations and relaxes the transferred temperature.          */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "InputParameters.h"
+#include "FixedPointAccelerator.h"
+#include "FieldExchange.h"
+#include "CouplingPerfLog.h"
+#include "FieldHistoryWriter.h"
+#include "ReactorLogInterface.h"
+#include "PerfGraph.h"
+
+class FEProblemBase;
+class MooseObject;
+class ReactorFieldChannel;
+class WarmStartSolverInterface;
+class SplitPhaseSolverInterface;
+class BurnupCheckpointWriter;
+class BurnupCheckpointReader;
+
+/**
+ * 核热耦合固定点迭代接口
+ * Fixed-point engine for the neutronics-thermal coupling loop.
+ *
+ * 每次迭代后读取主应用中的功率场和温度场，计算与上一次迭代的L2或Linf变化，
+ * 达到容差后停止；温度场在下一次中子学计算之前按所选方法松弛。
+ * After each iteration the power and temperature fields of the parent app are
+ * compared with the previous iterate; the loop stops once the change is below
+ * the tolerance. The temperature handed back to neutronics is relaxed with the
+ * selected method.
+ *
+ * 指定 field_channel 时，变化量和松弛直接作用在兄弟多应用之间的通道缓冲区上，
+ * 主应用中的场只用于输出。
+ * With a field_channel the change is measured on, and the relaxation applied to,
+ * the channel buffers exchanged between the sibling multiapps; the parent copies
+ * are then only needed for output.
+ *
+ * 多应用带有热启动求解器时，内迭代容差从 inner_tolerance_max 开始，
+ * 随外迭代的相对变化按 inner_tolerance_factor 逐步收紧。
+ * Multiapps with warm-started solvers start each coupling loop at
+ * inner_tolerance_max; the inner tolerance then follows
+ * inner_tolerance_factor times the outer relative change and never loosens.
+ *
+ * coupling_scheme = JACOBI 时中子学和热工多应用同时启动，都使用上一次迭代的场，
+ * 温度和功率一起松弛；场只能经由 field_channel 交换。
+ * With coupling_scheme = JACOBI the neutronics and thermal multiapps are
+ * launched together on the previous iterate and temperature and power are
+ * relaxed together; the fields must go through the field_channel.
+ *
+ * coarse_factor > 1 时每个燃耗步的前几次迭代在粗化的网格上求解 (多重网格耦合)，
+ * 场在多应用中限制到粗网格、结果延拓回细网格；粗网格迭代收敛到 coarse_rel_tol
+ * 或达到 coarse_max_its 后转到细网格，只有细网格上的变化才能判为收敛。
+ * With coarse_factor > 1 the first iterations of every burnup step solve on
+ * coarsened grids (multilevel coupling): the multiapps restrict their inputs
+ * and prolong their results. Once the coarse change reaches coarse_rel_tol, or
+ * after coarse_max_its, the loop finishes on the fine grid; only a fine
+ * iteration can be converged.
+ *
+ * 每个多应用执行标志和每次耦合迭代都登记为 PerfGraph 计时段；指定 perf_log 时
+ * 另外按燃耗步输出 CSV 性能报告。
+ * Every multiapp execution flag and every coupling iteration is a PerfGraph
+ * section; with perf_log a CSV breakdown is also written per burnup step.
+ */
+class CouplingFixedPointInterface : public ReactorLogInterface
+{
+public:
+  static InputParameters validParams();
+
+  CouplingFixedPointInterface(const MooseObject * moose_object);
+
+  /// 最近一次耦合计算的迭代次数
+  unsigned int fixedPointIterations() const { return _fp_iterations; }
+
+  /// 最近一次耦合计算是否收敛
+  bool fixedPointConverged() const { return _fp_converged; }
+
+protected:
+  /**
+   * 执行固定点迭代
+   * @param min_its 最小迭代次数
+   * @param max_its 最大迭代次数
+   * @param rel_tol 相对变化容差
+   * @param abs_tol 绝对变化容差
+   * @return 是否收敛
+   */
+  bool solveCoupledFixedPoint(unsigned int min_its, unsigned int max_its, Real rel_tol, Real abs_tol);
+
+  /// 建立主应用场的数据交换器
+  void setupCouplingFields();
+
+  /// 收集带热启动求解器的多应用
+  void findInnerSolvers();
+
+  /// 收集 JACOBI 格式同时启动的多应用
+  void findSplitPhaseSolvers();
+
+  /// 同时执行中子学和热工多应用 (JACOBI)
+  void execConcurrentMultiApps();
+
+  /// 所有热启动求解器的累计内迭代次数
+  unsigned long totalInnerIterations() const;
+
+  /**
+   * 执行一个多应用标志，并计入对应阶段的时间
+   * @param flag 执行标志
+   * @param phase 性能报告中的阶段
+   * @return 多应用是否执行成功
+   */
+  bool execCouplingMultiApps(const ExecFlagType & flag, CouplingPerfLog::Phase phase);
+
+  /// 开始一个燃耗步的统计
+  void beginCouplingStep(unsigned int step);
+
+  /// 结束燃耗步，写出性能报告并记录场历史
+  void endCouplingStep(unsigned int step);
+
+  /**
+   * 把功率场和温度场的快照交给后台写出 (按 field_history_* 参数抽样)
+   * @param iteration 耦合迭代 (0 为燃耗步结束时的场)
+   * @param power 功率场 (为 nullptr 时从通道或主应用读取)
+   * @param temperature 温度场 (为 nullptr 时从通道或主应用读取)
+   */
+  void recordFieldHistory(unsigned int iteration,
+                          const std::vector<Real> * power = nullptr,
+                          const std::vector<Real> * temperature = nullptr);
+
+  /**
+   * 把耦合状态写入检查点：最近一次迭代、交换的功率场和温度场
+   * (通道中的所有场或主应用中的场) 以及各求解器的状态
+   * Adds the coupling state to a checkpoint: the last iterate, the exchanged
+   * power and temperature fields (the whole channel, or the parent fields)
+   * and the state of every stateful solver.
+   */
+  void saveCouplingCheckpoint(BurnupCheckpointWriter & writer);
+
+  /// 从检查点恢复耦合状态
+  void restoreCouplingCheckpoint(const BurnupCheckpointReader & reader);
+
+  /// 读取耦合功率场的本地值 (通道中尚无数据时为空)
+  void readCoupledPower(std::vector<Real> & values) const;
+
+  /// 读取耦合温度场的本地值 (通道中尚无数据时为空)
+  void readCoupledTemperature(std::vector<Real> & values) const;
+
+  /// 写回松弛后的温度场
+  void writeCoupledTemperature(const std::vector<Real> & values) const;
+
+  /// 写回松弛后的功率场 (JACOBI)
+  void writeCoupledPower(const std::vector<Real> & values) const;
+
+  /// 拼接通道中某个场的所有实例
+  void readChannelFields(const std::string & base, std::vector<Real> & values) const;
+
+  /// 把拼接的值拆回通道中某个场的各实例
+  void writeChannelFields(const std::string & base, const std::vector<Real> & values) const;
+
+  /// 设置所有热启动求解器的内迭代容差
+  void setInnerTolerance(Real tol) const;
+
+  /// 恢复多应用自身的内迭代容差
+  void resetInnerTolerance() const;
+
+  /// 设置所有热启动求解器的网格粗化系数 (1 为细网格)
+  void setCoarsening(unsigned int factor) const;
+
+  /// 读取主应用场的本地值
+  void readField(FieldExchange & exchange, std::vector<Real> & values) const;
+
+  /// 把本地值写回主应用场
+  void writeField(FieldExchange & exchange, const std::vector<Real> & values) const;
+
+  /**
+   * 计算两次迭代之间的变化
+   * @param current 当前迭代值
+   * @param previous 上一次迭代值
+   * @param abs_change 返回绝对变化
+   * @param rel_change 返回相对变化
+   */
+  void fieldChange(const std::vector<Real> & current,
+                   const std::vector<Real> & previous,
+                   Real & abs_change,
+                   Real & rel_change) const;
+
+  /// FE问题引用
+  FEProblemBase & _fp_problem;
+
+  /// 主应用中的功率场和温度场名称
+  const std::string & _fp_power_var_name;
+  const std::string & _fp_temperature_var_name;
+
+  /// 收敛判据是否使用Linf范数 (否则使用L2范数)
+  const bool _fp_use_linf;
+
+  /// 是否使用 JACOBI 格式 (否则为 GAUSS_SEIDEL)
+  const bool _fp_jacobi;
+
+  /// 松弛/加速器
+  FixedPointAccelerator _fp_accelerator;
+
+  /// 兄弟多应用之间的场数据通道名称与对象 (可选，第一次迭代时获取)
+  const UserObjectName _fp_channel_object;
+  ReactorFieldChannel * _fp_channel;
+
+  /// 通道中的功率场和温度场名称
+  const std::string & _fp_channel_power_name;
+  const std::string & _fp_channel_temperature_name;
+
+  /// 内迭代容差的上下限与收紧系数
+  const Real _fp_inner_tol_max;
+  const Real _fp_inner_tol_min;
+  const Real _fp_inner_tol_factor;
+
+  /// 多重网格耦合的粗化系数、粗网格最大迭代次数和转到细网格的相对变化
+  const unsigned int _fp_coarse_factor;
+  const unsigned int _fp_coarse_max_its;
+  const Real _fp_coarse_rel_tol;
+
+  /// 带热启动求解器的多应用
+  std::vector<WarmStartSolverInterface *> _fp_inner_solvers;
+  bool _fp_inner_solvers_found;
+
+  /// JACOBI 格式同时启动的多应用
+  std::vector<SplitPhaseSolverInterface *> _fp_split_solvers;
+
+  /// 燃耗步开始时的累计内迭代次数
+  unsigned long _fp_step_inner_its;
+
+  /// 主应用场的数据交换器
+  std::unique_ptr<FieldExchange> _fp_power_exchange;
+  std::unique_ptr<FieldExchange> _fp_temperature_exchange;
+
+  /// 上一次迭代的温度 (松弛后的输入) 与功率
+  std::vector<Real> _fp_temperature_input;
+  std::vector<Real> _fp_power_previous;
+
+  /// 当前迭代的温度与功率
+  std::vector<Real> _fp_temperature;
+  std::vector<Real> _fp_power;
+
+  /// JACOBI 格式中一起松弛的 (温度, 功率)
+  std::vector<Real> _fp_stacked_input;
+  std::vector<Real> _fp_stacked_output;
+
+  /// 最近一次耦合计算的统计
+  unsigned int _fp_iterations;
+  bool _fp_converged;
+  Real _fp_temperature_change;
+  Real _fp_power_change;
+
+  /// 最近一次耦合计算的粗网格迭代次数
+  unsigned int _fp_coarse_iterations;
+
+  /// 是否已建立场的访问
+  bool _fp_setup;
+
+  /// 每个燃耗步的性能报告
+  CouplingPerfLog _fp_perf_log;
+
+  /// 场历史及其燃耗步和耦合迭代的抽样间隔
+  FieldHistoryWriter _fp_history;
+  const unsigned int _fp_history_step_interval;
+  const unsigned int _fp_history_iteration_interval;
+
+  /// 当前燃耗步与最近一次记录场历史的耦合迭代
+  unsigned int _fp_step;
+  unsigned int _fp_history_iteration;
+
+  /// PerfGraph 及计时段
+  PerfGraph & _fp_perf_graph;
+  const PerfID _fp_iteration_timer;
+  const PerfID _fp_relaxation_timer;
+  const PerfID _fp_concurrent_timer;
+  std::map<ExecFlagType, PerfID> _fp_flag_timers;
+};
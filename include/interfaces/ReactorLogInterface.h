@@ -0,0 +1,60 @@
+/****************************************************************/
+/* ReactorLogInterface.h                                        */
+/* Verbosity-Controlled Console Logging                         */
+/*                                                              */
+/* Replaces the unconditional std::cout banners of the coupling */
+/* objects with console output filtered by log_level.           */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "InputParameters.h"
+#include "ConsoleStream.h"
+
+class MooseObject;
+
+/**
+ * 按输出级别过滤的控制台日志
+ * Console logging filtered by the log_level parameter.
+ *
+ * 使用 reactorLog(LEVEL, a << b) 输出；级别不够时消息表达式不会被求值，
+ * 关闭时只剩一次整数比较。
+ * Messages are written with reactorLog(LEVEL, a << b); the stream expression
+ * is only evaluated when the level is enabled, so a disabled message costs a
+ * single integer comparison.
+ */
+class ReactorLogInterface
+{
+public:
+  static InputParameters validParams();
+
+  ReactorLogInterface(const MooseObject * moose_object);
+
+  /// 输出级别
+  enum LogLevel
+  {
+    QUIET = 0,     ///< 只输出警告
+    SUMMARY = 1,   ///< 每个燃耗步一行摘要
+    ITERATION = 2, ///< 每次耦合迭代
+    DEBUG = 3      ///< 每次多应用/传输调用
+  };
+
+protected:
+  /// 当前输出级别
+  const unsigned int _log_level;
+
+  /// 控制台输出流 (只在主进程输出)
+  const ConsoleStream _log_console;
+};
+
+/// 按级别输出一条消息，例如 reactorLog(ITERATION, "it=" << it);
+#define reactorLog(level, message)                                                                 \
+  do                                                                                               \
+  {                                                                                                \
+    if (_log_level >= ReactorLogInterface::level)                                                  \
+      _log_console << message << std::endl;                                                        \
+  } while (false)
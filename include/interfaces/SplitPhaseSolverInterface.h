@@ -0,0 +1,40 @@
+/****************************************************************/
+/* SplitPhaseSolverInterface.h                                  */
+/* Launch/Complete Interface for Concurrent Multiapp Solves     */
+/*                                                              */
+/* Lets the coupling loop start the Fortran kernels of several  */
+/* multiapps before waiting for any of them (JACOBI scheme).    */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+/**
+ * 分阶段求解接口
+ * Split-phase solve of a multiapp.
+ *
+ * launchSolve() 在调用线程上读入输入场，然后在后台线程启动求解器并立即返回；
+ * completeSolve() 等待求解器结束并在调用线程上写出结果。两次调用之间可以启动
+ * 其他多应用，使中子学和热工求解器同时运行。
+ * launchSolve() reads the input fields on the calling thread, starts the kernel
+ * on a background thread and returns; completeSolve() waits for it and writes
+ * the results on the calling thread. Other multiapps may be launched in
+ * between, so the neutronics and thermal kernels run at the same time.
+ *
+ * 后台线程只运行 Fortran 求解器：MPI、PETSc 和 MOOSE 的调用都留在调用线程上。
+ * The background thread only runs the Fortran kernel; MPI, PETSc and MOOSE
+ * calls stay on the calling thread.
+ */
+class SplitPhaseSolverInterface
+{
+public:
+  virtual ~SplitPhaseSolverInterface() = default;
+
+  /// 读入输入场并在后台启动求解器
+  virtual void launchSolve() = 0;
+
+  /// 等待求解器结束并写出结果
+  virtual void completeSolve() = 0;
+};
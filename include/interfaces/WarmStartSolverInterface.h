@@ -0,0 +1,96 @@
+/****************************************************************/
+/* WarmStartSolverInterface.h                                   */
+/* Inner Solve Control for Stateful Fortran Solvers             */
+/*                                                              */
+/* Shared by the neutronics and thermal multiapps: holds the    */
+/* inner tolerance that the coupling loop may tighten and the   */
+/* warm-start switch of the persistent solver handle.           */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "InputParameters.h"
+
+class MooseObject;
+class BurnupCheckpointWriter;
+class BurnupCheckpointReader;
+
+/**
+ * 带状态求解器的内迭代控制接口
+ * Inner-solve control of a multiapp that owns a stateful Fortran solver.
+ *
+ * 求解器句柄跨耦合迭代和燃耗步保留上一次的解，因此每次求解都是热启动；
+ * 耦合迭代可以在外迭代收敛过程中逐步收紧内迭代容差（非精确内迭代）。
+ * The solver handle keeps the previous solution across coupling iterations and
+ * burnup steps, so every solve is warm-started. The coupling loop may tighten
+ * the inner tolerance as the outer iteration converges (inexact inner solves);
+ * outside the loop the multiapp's own inner_tolerance applies.
+ *
+ * 多重网格耦合的粗网格迭代中，耦合迭代设置粗化系数，求解器在粗化的网格上
+ * 求解，输入场先限制到粗网格，结果再延拓回细网格。
+ * For the coarse iterations of the multilevel coupling the loop sets a
+ * coarsening factor: the inputs are restricted to the coarsened grid, the
+ * solver runs there and its result is prolonged back to the fine grid.
+ */
+class WarmStartSolverInterface
+{
+public:
+  static InputParameters validParams();
+
+  WarmStartSolverInterface(const MooseObject * moose_object);
+
+  virtual ~WarmStartSolverInterface() = default;
+
+  /// 由耦合迭代设置内迭代容差
+  void setInnerTolerance(Real tol) { _inner_tol = tol; }
+
+  /// 恢复输入文件中的内迭代容差
+  void resetInnerTolerance() { _inner_tol = _default_inner_tol; }
+
+  /// 当前内迭代容差
+  Real innerTolerance() const { return _inner_tol; }
+
+  /// 由耦合迭代设置求解网格的粗化系数 (1 为细网格)
+  void setCoarsening(unsigned int factor) { _coarsening = factor; }
+
+  /// 当前粗化系数
+  unsigned int coarsening() const { return _coarsening; }
+
+  /// 最近一次求解的内迭代次数
+  unsigned int innerIterations() const { return _inner_its; }
+
+  /// 累计内迭代次数
+  unsigned long totalInnerIterations() const { return _total_inner_its; }
+
+  /// 把本进程所有求解器句柄的状态写入检查点
+  virtual void saveSolverState(BurnupCheckpointWriter & writer) = 0;
+
+  /// 从检查点恢复求解器句柄的状态 (必要时先建立句柄)
+  virtual void restoreSolverState(const BurnupCheckpointReader & reader) = 0;
+
+protected:
+  /// 输入文件中的内迭代容差
+  const Real _default_inner_tol;
+
+  /// 当前内迭代容差
+  Real _inner_tol;
+
+  /// 最大内迭代次数
+  const unsigned int _max_inner_its;
+
+  /// 是否从上一次的解热启动
+  const bool _warm_start;
+
+  /// 求解网格的粗化系数
+  unsigned int _coarsening;
+
+  /// 最近一次求解的内迭代次数
+  unsigned int _inner_its;
+
+  /// 累计内迭代次数
+  unsigned long _total_inner_its;
+};
@@ -5,35 +5,73 @@
 
 #pragma once
 
-#include "FullSolveMultiApp.h"
+#include "ReactorKernelMultiApp.h"
 
 // 声明Fortran接口
 extern "C" {
   void b1_execute(int* mesh_dims, double* power_data, double* temperature_data, int field_size);
+
+  // 带状态的求解接口：句柄由C++端创建和释放；场大小与创建时不一致时 inner_its 为 -1
+  void * b1_create(int* mesh_dims, int field_size);
+  void b1_destroy(void * handle);
+  void b1_reset(void * handle);
+  void b1_solve(void * handle, int* mesh_dims, double* power_data, double* temperature_data,
+                int field_size, double inner_tol, int max_inner_its, int* inner_its);
+
+  // 批量求解接口：本进程所有实例的场按 offsets 连续存放，一次调用求解
+  void b1_solve_batch(int n_instances, void ** handles, int* mesh_dims, int* offsets,
+                      double* power_data, double* temperature_data, double inner_tol,
+                      int max_inner_its, int* inner_its, double* seconds);
+
+  // 求解器状态的保存与恢复 (缓冲区内容对C++端不透明)
+  size_t b1_state_size(void * handle);
+  void b1_save_state(void * handle, void * buffer, size_t nbytes);
+  int b1_load_state(void * handle, const void * buffer, size_t nbytes);
+
+  // 每个句柄 (算例) 的功率比例和温度反馈系数，保留到句柄释放，不受 b1_reset 影响
+  void b1_set_parameters(void * handle, double power_scale, double feedback);
 }
 
 /**
  * 中子学多应用类，简化版
- * 用于调用外部b1_execute计算程序
+ * 用于调用外部b1_execute计算程序：读入温度场，写出功率场
+ *
+ * 每个进程上的所有子应用实例 (positions) 的场拼接成一个连续数组，
+ * 通过 b1_solve_batch 一次求解 (见 ReactorKernelMultiApp)。
+ * All local instances (positions) are solved in one b1_solve_batch call on a
+ * contiguous buffer (see ReactorKernelMultiApp).
+ *
+ * power_scales 和 feedback_coefficients 为每个位置 (算例) 给出自己的功率比例和
+ * 温度反馈系数，例如算例集合中的扰动算例。
+ * power_scales and feedback_coefficients give every position (case) its own
+ * power scale and temperature feedback coefficient, e.g. the perturbed cases
+ * of an ensemble.
  */
-class NeutronicsMultiApp : public FullSolveMultiApp
+class NeutronicsMultiApp : public ReactorKernelMultiApp
 {
 public:
   static InputParameters validParams();
   NeutronicsMultiApp(const InputParameters & parameters);
 
 protected:
-  virtual bool solveStep(Real dt, Real target_time, bool auto_advance) override;
-  
-  // 核心方法：执行b1_execute中子计算
-  void executeB1Solver();
-
-  // 网格维度参数
-  const std::vector<int> _mesh_dims;
-  
-  // 变量名称参数
-  const std::string _power_var_name;
-  const std::string _temperature_var_name;
+  // 子应用中既没有功率场也没有温度场时跳过求解
+  virtual bool hasKernelFields(FEProblemBase & problem) const override;
+
+  // 把每个实例所在位置的参数交给细网格和粗网格求解器
+  virtual void setupKernelArrays() override;
+  virtual void setupCoarseArrays() override;
+
+  // 一个位置的参数 (只给一个值时所有位置相同)
+  Real positionValue(const std::string & param, unsigned int position) const;
+
+  // 核心方法：b1_solve_batch 中子计算
+  virtual void solveBatch(std::size_t first,
+                          std::size_t count,
+                          void ** handles,
+                          int * mesh_dims,
+                          int * offsets,
+                          Real * input_data,
+                          Real * output_data) override;
 
   std::vector<double> power_density;
-}; 
\ No newline at end of file
+};
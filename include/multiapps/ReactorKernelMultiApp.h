@@ -0,0 +1,257 @@
+/****************************************************************/
+/* ReactorKernelMultiApp.h                                      */
+/* Base Class of the Fortran Kernel Multiapps                   */
+/*                                                              */
+/* Instances, batched buffers, solver pool, field channel and   */
+/* coarse level shared by the neutronics and thermal multiapps. */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "FullSolveMultiApp.h"
+#include "FieldExchange.h"
+#include "WarmStartSolverInterface.h"
+#include "ReactorLogInterface.h"
+#include "WorkStealingPool.h"
+#include "SplitPhaseSolverInterface.h"
+#include "StructuredGridTransfer.h"
+
+#include <future>
+
+class ReactorFieldChannel;
+
+/**
+ * Fortran 求解核心多应用的基类
+ * Base class of the multiapps whose solver core is a Fortran kernel.
+ *
+ * 每个子应用实例 (position) 有一个输入场和一个输出场：中子学读入温度、写出功率，
+ * 热工读入功率、写出温度。本进程上所有实例的场拼接成连续数组，通过一次批量调用
+ * (可在线程池上按实例并行) 求解；positions 可按上一次运行测得的每实例代价重排。
+ * Every instance (position) reads one input field and writes one output field:
+ * the neutronics reads the temperature and writes the power, the thermal app
+ * the reverse. The fields of all local instances are solved in one batched
+ * call (split over the solver pool by instance), and the positions can be
+ * placed by the per instance cost measured in a previous run.
+ *
+ * 子类只提供求解器句柄函数 (KernelFunctions)、批量求解调用和场的角色。
+ * Subclasses only provide the solver handle functions (KernelFunctions), the
+ * batched solve call and the roles of the fields.
+ */
+class ReactorKernelMultiApp : public FullSolveMultiApp,
+                              public WarmStartSolverInterface,
+                              public SplitPhaseSolverInterface,
+                              public ReactorLogInterface
+{
+public:
+  static InputParameters validParams();
+
+  /// 求解器读入的场
+  enum class InputField
+  {
+    POWER,
+    TEMPERATURE
+  };
+
+  /// Fortran 求解器句柄的接口 (b1_* 与 thermal_* 的签名相同)
+  struct KernelFunctions
+  {
+    /// 用于日志和计时的求解器名称
+    const char * name;
+    void * (*create)(int * mesh_dims, int field_size);
+    void (*destroy)(void * handle);
+    void (*reset)(void * handle);
+    size_t (*state_size)(void * handle);
+    void (*save_state)(void * handle, void * buffer, size_t nbytes);
+    int (*load_state)(void * handle, const void * buffer, size_t nbytes);
+  };
+
+  ReactorKernelMultiApp(const InputParameters & parameters,
+                        InputField input_field,
+                        const KernelFunctions & kernel);
+  virtual ~ReactorKernelMultiApp();
+
+protected:
+  virtual bool solveStep(Real dt, Real target_time, bool auto_advance = true) override;
+
+  // 按代价文件重排 positions
+  virtual void fillPositions() override;
+
+  // 写出每实例的代价
+  virtual void postExecute() override;
+
+  // 一个子应用实例的数据交换器和求解器状态
+  struct Instance
+  {
+    // 全局应用编号和原始位置编号
+    unsigned int app;
+    unsigned int position;
+
+    // 输入场与输出场的本地数据交换器
+    std::unique_ptr<FieldExchange> input_exchange;
+    std::unique_ptr<FieldExchange> output_exchange;
+
+    // 交给Fortran的本进程网格维度 (字典序时为 nx, ny, nz_local)
+    std::vector<int> kernel_mesh_dims;
+
+    // 场是否按字典序交给Fortran (网格未按 z 方向分块时退回自由度顺序)
+    bool lexicographic = false;
+
+    // 求解器句柄 (保留上一次的解)
+    void * solver_handle = nullptr;
+
+    // 通道中的输入场和输出场名称
+    std::string channel_input_name;
+    std::string channel_output_name;
+
+    // 发布输出场时使用的节点/单元编号
+    std::vector<dof_id_type> output_ids;
+
+    // 输入场从通道读取的映射
+    std::vector<std::size_t> input_mapping;
+    bool input_mapped = false;
+
+    // 本次调用打开的本地存储
+    Real * input_data = nullptr;
+    Real * output_data = nullptr;
+    bool from_channel = false;
+
+    // 累计的求解时间 (秒)
+    Real seconds = 0.0;
+
+    // 粗网格层级的限制/延拓和求解器句柄 (第一次粗网格求解时建立)
+    std::unique_ptr<StructuredGridTransfer> coarse_transfer;
+    void * coarse_handle = nullptr;
+  };
+
+  /**
+   * 批量求解第 first 个起的 count 个实例 (不访问 MOOSE，可在工作线程上调用)
+   * Solve count instances starting at first; no MOOSE calls (may run on a worker thread).
+   * handles、mesh_dims、offsets 已从 first 开始，offsets 索引整个缓冲区；
+   * 内迭代次数和耗时写入 _batch_inner_its 与 _batch_seconds 的 first 处。
+   * handles, mesh_dims and offsets already start at first, the offsets index the
+   * whole buffers; the inner iterations and times go to _batch_inner_its and
+   * _batch_seconds at first.
+   */
+  virtual void solveBatch(std::size_t first,
+                          std::size_t count,
+                          void ** handles,
+                          int * mesh_dims,
+                          int * offsets,
+                          Real * input_data,
+                          Real * output_data) = 0;
+
+  // 子类的附加设置：所有实例建立之后、粗网格层级建立之后，以及每次求解的输入读入之后
+  virtual void setupKernelArrays() {}
+  virtual void setupCoarseArrays() {}
+  virtual void prepareKernelInputs() {}
+
+  // 问题中没有这两个场时跳过求解 (默认总是求解)
+  virtual bool hasKernelFields(FEProblemBase & /*problem*/) const { return true; }
+
+  // 执行 Fortran 求解：读入、求解、写回
+  void executeKernelSolver();
+
+  // 建立本进程所有实例的数据交换器（只在第一次调用时建立）
+  void setupInstances();
+
+  // 建立一个实例的数据交换器
+  void setupFieldExchange(Instance & instance, FEProblemBase & app);
+
+  // 数据交换器所在的问题：子应用，或共享网格时的主应用
+  // problem holding the exchanged variables: the sub-app, or the parent when sharing its mesh
+  FEProblemBase & fieldProblem(unsigned int app);
+
+  // 读入输入场并打开本地存储；没有需要求解的实例时返回 false
+  bool copyInFields();
+
+  // 运行求解器 (可在后台线程上调用，不访问 MOOSE)
+  void runKernel();
+
+  // 统计内迭代、发布并写回结果
+  void copyOutFields();
+
+  // 建立当前粗化系数的粗网格求解器和批量调用数组
+  void setupCoarseLevel();
+
+  // 分阶段求解：供 JACOBI 耦合格式同时运行中子学和热工
+  virtual void launchSolve() override;
+  virtual void completeSolve() override;
+
+  // 检查点：每个实例的求解器状态保存在 solver/<multiapp>/<position> 段
+  virtual void saveSolverState(BurnupCheckpointWriter & writer) override;
+  virtual void restoreSolverState(const BurnupCheckpointReader & reader) override;
+
+  // 实例求解器状态在检查点中的段名
+  std::string solverSectionName(const Instance & instance) const;
+
+  // 求解第 first 个起的 count 个实例 (缓冲区按 _batch_offsets 索引)
+  void solveInstances(std::size_t first, std::size_t count, Real * input_data, Real * output_data);
+
+  // Fortran 求解器句柄接口
+  const KernelFunctions _kernel;
+
+  // 网格维度 (必须是3个整数)
+  const std::vector<int> _mesh_dims;
+
+  // 是否按结构网格字典序 (i,j,k) 交给Fortran
+  const bool _lexicographic_layout;
+
+  // 是否直接使用主应用网格上的变量，子应用不再需要自己的网格变量和系统
+  const bool _use_parent_mesh;
+
+  // 输入场和输出场变量名 (按 InputField 取 power_var_name 或 temperature_var_name)
+  const std::string _input_var_name;
+  const std::string _output_var_name;
+
+  // 按代价重排 positions 的代价文件，以及写出本次代价的文件
+  const FileName _instance_cost_file;
+  const FileName _instance_cost_output;
+
+  // 本进程上的实例
+  std::vector<Instance> _instances;
+
+  // 批量调用的连续缓冲区 (只有一个实例时直接使用本地存储)
+  std::vector<void *> _batch_handles;
+  std::vector<int> _batch_mesh_dims;
+  std::vector<int> _batch_offsets;
+  std::vector<Real> _batch_input;
+  std::vector<Real> _batch_output;
+  std::vector<int> _batch_inner_its;
+  std::vector<Real> _batch_seconds;
+
+  // 同时求解本进程实例的线程数，以及对应的线程池 (多于一个线程和实例时才建立)
+  const unsigned int _solver_threads;
+  std::unique_ptr<WorkStealingPool> _solver_pool;
+
+  // 兄弟多应用之间的场数据通道 (可选)
+  ReactorFieldChannel * _field_channel;
+
+  // 本次求解交给Fortran的输入场和输出场
+  Real * _kernel_input_data;
+  Real * _kernel_output_data;
+
+  // 本次求解是否在粗网格上
+  bool _kernel_coarse;
+
+  // 粗网格层级的批量调用数组及其粗化系数 (0 表示尚未建立)
+  unsigned int _coarse_factor;
+  std::vector<void *> _coarse_handles;
+  std::vector<int> _coarse_mesh_dims;
+  std::vector<int> _coarse_offsets;
+  std::vector<Real> _coarse_input;
+  std::vector<Real> _coarse_output;
+
+  // 后台运行的求解器 (分阶段求解)
+  std::future<void> _pending_solve;
+  bool _solve_launched;
+
+  // 通道中的输入场和输出场名称
+  const std::string _channel_input_name;
+  const std::string _channel_output_name;
+
+  // 新顺序中每个应用对应的原始位置编号
+  std::vector<unsigned int> _position_order;
+};
@@ -11,14 +11,51 @@
 
 #pragma once
 
-#include "FullSolveMultiApp.h"
+#include "ReactorKernelMultiApp.h"
+#include "ChannelChangeTracker.h"
 
 // 声明 Fortran 模块中的热工计算函数
 extern "C" {
   void thermal_execute(int* mesh_dims, double* power_field, double* temperature_field, int field_size);
+
+  // 带状态的求解接口：句柄由C++端创建和释放；场大小与创建时不一致时 inner_its 为 -1
+  void * thermal_create(int* mesh_dims, int field_size);
+  void thermal_destroy(void * handle);
+  void thermal_reset(void * handle);
+  // active_channels 标记需要重新求解的 (i,j) 通道，其余通道保留上一次的温度
+  void thermal_solve(void * handle, int* mesh_dims, double* power_field, double* temperature_field,
+                     int field_size, int* active_channels, double inner_tol, int max_inner_its,
+                     int* inner_its);
+
+  // 批量求解接口：本进程所有实例的场按 offsets 连续存放，通道标记按 channel_offsets 连续存放，
+  // 一次调用求解
+  void thermal_solve_batch(int n_instances, void ** handles, int* mesh_dims, int* offsets,
+                           double* power_field, double* temperature_field, int* channel_offsets,
+                           int* active_channels, double inner_tol, int max_inner_its,
+                           int* inner_its, double* seconds);
+
+  // 求解器状态的保存与恢复 (缓冲区内容对C++端不透明)
+  size_t thermal_state_size(void * handle);
+  void thermal_save_state(void * handle, void * buffer, size_t nbytes);
+  int thermal_load_state(void * handle, const void * buffer, size_t nbytes);
 }
 
-class ThermalMultiApp : public FullSolveMultiApp
+/**
+ * 热工多应用：读入功率场，写出温度场
+ * 本进程上的所有子应用实例通过 thermal_solve_batch 一次求解 (见 ReactorKernelMultiApp)；
+ * 与中子学多应用使用相同的代价文件时，配对的实例位于同一进程。
+ * All local instances are solved in one thermal_solve_batch call (see
+ * ReactorKernelMultiApp). With the same instance_cost_file as the neutronics
+ * multiapp, paired instances end up on the same rank.
+ *
+ * power_change_threshold 大于 0 时只重新求解功率变化超过阈值的 (i,j) 通道，
+ * 其余通道的温度保留在求解器状态中。
+ * With power_change_threshold > 0 only the (i,j) channels whose power moved
+ * beyond the threshold are solved again; the other channels keep the
+ * temperature held in the solver state.
+ */
+
+class ThermalMultiApp : public ReactorKernelMultiApp
 {
 public:
   static InputParameters validParams();
@@ -26,19 +63,36 @@ public:
   ThermalMultiApp(const InputParameters & parameters);
   
 protected:
-  virtual bool solveStep(Real dt, Real target_time, bool auto_advance = true) override;
-  
+  // 建立通道偏移、通道标记和功率变化跟踪
+  virtual void setupKernelArrays() override;
+  virtual void setupCoarseArrays() override;
+
+  // 标记需要重新求解的通道
+  virtual void prepareKernelInputs() override;
+
+  // 恢复的温度与跟踪的功率参考值不对应，下一次求解所有通道
+  virtual void restoreSolverState(const BurnupCheckpointReader & reader) override;
+
   // 执行热工计算
-  void executeThermalSolver();
-  
-  // 网格维度 (必须是3个整数)
-  std::vector<int> _mesh_dims;
+  virtual void solveBatch(std::size_t first,
+                          std::size_t count,
+                          void ** handles,
+                          int * mesh_dims,
+                          int * offsets,
+                          Real * input_data,
+                          Real * output_data) override;
 
+  // 批量调用的通道偏移和需要重新求解的通道标记
+  std::vector<int> _batch_channel_offsets;
+  std::vector<int> _batch_active;
 
-  
-  // 功率场变量名
-  const std::string _power_var_name;
-  
-  // 温度场变量名
-  const std::string _temperature_var_name;
-}; 
\ No newline at end of file
+  // 粗网格层级的通道偏移和通道标记 (总是求解所有通道)
+  std::vector<int> _coarse_channel_offsets;
+  std::vector<int> _coarse_active;
+
+  // 功率变化阈值 (相对于本地功率场最大值，0 表示每次求解所有通道)
+  const Real _power_change_threshold;
+
+  // 每个实例细网格功率场的逐通道变化跟踪 (power_change_threshold > 0 且场为字典序时)
+  std::vector<std::unique_ptr<ChannelChangeTracker>> _power_trackers;
+};
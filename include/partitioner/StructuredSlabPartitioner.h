@@ -0,0 +1,40 @@
+/****************************************************************/
+/* StructuredSlabPartitioner.h                                  */
+/* Z-Slab Partitioner for Structured Sub-App Meshes             */
+/*                                                              */
+/* Gives every rank a contiguous run of whole element layers    */
+/* along z, as required by the lexicographic field exchange.    */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "MoosePartitioner.h"
+
+/**
+ * 按 z 方向分块的分区器
+ * Partitions a structured mesh into z-slabs.
+ *
+ * 单元按其中心的 z 坐标在网格高度上等分给各进程，同一层单元总是在同一个进程上，
+ * 因此每个进程拥有连续的若干个完整 k 平面 (节点归属相邻单元中编号最小的进程)，
+ * 多应用可以按字典序子块 nx*ny*nz_local 交换场。
+ * Elements go to the ranks by the z coordinate of their centre over equal
+ * shares of the mesh height. A layer of elements always lands on one rank,
+ * so every rank owns a contiguous run of whole k-planes (a node belongs to
+ * the lowest rank among its elements) and the multiapps can exchange the
+ * fields as nx*ny*nz_local boxes.
+ */
+class StructuredSlabPartitioner : public MoosePartitioner
+{
+public:
+  static InputParameters validParams();
+
+  StructuredSlabPartitioner(const InputParameters & params);
+
+  virtual std::unique_ptr<Partitioner> clone() const override;
+
+protected:
+  virtual void _do_partition(MeshBase & mesh, const unsigned int n) override;
+};
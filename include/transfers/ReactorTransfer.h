@@ -12,13 +12,14 @@
 #pragma once
 
 #include "MultiAppCopyTransfer.h"
+#include "ReactorLogInterface.h"
 
 /**
  * 反应堆数据传输类，用于支持自定义执行标志的数据传输
  * 继承自MultiAppCopyTransfer，增加了对自定义执行标志的支持
  */
 // ReactorTransfer.h
-class ReactorTransfer : public MultiAppCopyTransfer
+class ReactorTransfer : public MultiAppCopyTransfer, public ReactorLogInterface
 {
 public:
   static InputParameters validParams();
@@ -15,12 +15,14 @@
 #include "FEProblem.h"
 #include "MultiApp.h"
 #include "MultiAppTransfer.h"
+#include "CouplingFixedPointInterface.h"
 
 extern "C" {
   void update_burnup_step(int step, int max_steps);
+  void update_burnup_detailed(int step, int max_steps, double burnup_value, double power, double time_step);
 }
 
-class ReactorCouplingUserObject : public GeneralUserObject
+class ReactorCouplingUserObject : public GeneralUserObject, public CouplingFixedPointInterface
 {
 public:
   static InputParameters validParams();
@@ -61,7 +63,8 @@ protected:
   bool executeSubsequentStep();
   
   /**
-   * 更新Fortran程序中的燃耗步
+   * 更新Fortran程序中的燃耗步，累积本步燃耗并通过 update_burnup_detailed 传递
+   * (每个燃耗步调用一次)
    */
   void updateFortranBurnupStep();
 
@@ -69,18 +72,15 @@ protected:
   /// 计算类型: 1-仅中子学, 2-耦合计算
   unsigned int _calc_type;
   
-  /// 当前燃耗步
-  unsigned int _burn_step;
+  /// 当前燃耗步 (可重启数据，随 MOOSE 检查点保存；求解器状态与耦合迭代值
+  /// 的完整重启仅由 BurnupExecutioner 的检查点提供)
+  /// Current burnup step (restartable). Only BurnupExecutioner checkpoints
+  /// restore the solver state and the coupling iterate as well.
+  unsigned int & _burn_step;
   
   /// 最大燃耗步数
   const unsigned int _max_burn_steps;
   
-  /// 最大耦合迭代次数
-  const unsigned int _max_coupling_iterations;
-  
-  /// 耦合收敛容差
-  const Real _coupling_tolerance;
-  
   /// 中子学多应用程序名称
   const std::string _neutronics_app_name;
   
@@ -91,8 +91,24 @@ protected:
   const unsigned int _fixed_point_max_its;
   const unsigned int _fixed_point_min_its;
   const Real _fixed_point_tol;
+  const Real _fixed_point_abs_tol;
   const bool _accept_on_max_iteration;
+
+  /// 每个燃耗步结束时的累积燃耗 (MWd/tU，可重启数据)
+  std::vector<Real> & _burnup_values;
+
+  /// 功率水平 (MW)
+  const Real _power_level;
+
+  /// 本燃耗步的时间步长 (天)
+  Real _time_step;
+
+  /// 重金属质量 (tU)
+  const Real _heavy_metal_mass;
   
   /// FE问题引用
   FEProblemBase & _fe_problem;
+
+  /// 每个燃耗步的 PerfGraph 计时段
+  const PerfID _step_timer;
 };
\ No newline at end of file
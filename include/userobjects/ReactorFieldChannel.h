@@ -0,0 +1,115 @@
+/****************************************************************/
+/* ReactorFieldChannel.h                                        */
+/* Direct Field Channel Between Sibling MultiApps               */
+/*                                                              */
+/* Holds named field buffers published by one multiapp and      */
+/* consumed by another without routing through the parent.      */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+class BurnupCheckpointWriter;
+class BurnupCheckpointReader;
+
+/**
+ * 兄弟多应用之间的场数据通道
+ * Field channel between sibling multiapps.
+ *
+ * 生产者（如中子学多应用）把本进程的场数据按自己的自由度顺序发布，
+ * 消费者（如热工多应用）用一次性建立的映射直接读取，不再经过主应用。
+ * The producer publishes its rank-local field in its own DOF order together
+ * with the node/element ids of the entries. A consumer builds an index map
+ * against those ids once and then reads the buffer directly, so no parent
+ * copy and no DOF-map lookups are needed per coupling iteration.
+ *
+ * 两个子应用必须使用相同的网格和分区，每个进程上的本地节点/单元一致。
+ * Both sub-apps must use the same mesh and partitioning so that every rank
+ * owns the same nodes/elements in both.
+ */
+class ReactorFieldChannel : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  ReactorFieldChannel(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /**
+   * 发布场数据
+   * @param name 场名称
+   * @param ids 各数据对应的节点/单元编号（第一次发布时登记）
+   * @param values 本地场数据
+   * @param size 数据长度
+   */
+  void publish(const std::string & name,
+               const std::vector<dof_id_type> & ids,
+               const Real * values,
+               std::size_t size);
+
+  /// 是否已发布该场
+  bool hasField(const std::string & name) const;
+
+  /**
+   * 建立消费者到生产者数据的映射
+   * @param name 场名称
+   * @param ids 消费者各数据对应的节点/单元编号
+   * @param mapping 返回消费者第i个数据在生产者缓冲区中的位置
+   * @return 映射是否为恒等映射（此时mapping为空，可直接拷贝）
+   */
+  bool buildMapping(const std::string & name,
+                    const std::vector<dof_id_type> & ids,
+                    std::vector<std::size_t> & mapping) const;
+
+  /**
+   * 按映射读取场数据
+   * @param name 场名称
+   * @param mapping buildMapping 得到的映射，为空时按恒等映射拷贝
+   * @param values 输出数组
+   */
+  void consume(const std::string & name,
+               const std::vector<std::size_t> & mapping,
+               Real * values) const;
+
+  /// 生产者顺序的场数据 (供固定点迭代读取和松弛)
+  std::vector<Real> & fieldValues(const std::string & name);
+
+  /**
+   * 本进程上某个场的所有实例名称 (base 以及 base:<position>)，顺序固定
+   * All names of a field on this rank, i.e. base itself and the per instance
+   * names base:<position>, in a fixed order.
+   */
+  std::vector<std::string> fieldNames(const std::string & base) const;
+
+  /// 多实例多应用中第 position 个实例的场名称
+  static std::string instanceFieldName(const std::string & base, unsigned int position);
+
+  /// 把所有场写入检查点 (channel/<name>/values 与 channel/<name>/ids 段)
+  void saveFields(BurnupCheckpointWriter & writer) const;
+
+  /// 从检查点恢复所有场 (替换通道中已有的场)
+  void restoreFields(const BurnupCheckpointReader & reader);
+
+protected:
+  /// 通道中的一个场
+  struct Field
+  {
+    /// 生产者顺序的本地数据
+    std::vector<Real> values;
+
+    /// 各数据对应的节点/单元编号
+    std::vector<dof_id_type> ids;
+  };
+
+  const Field & getField(const std::string & name) const;
+
+  /// 场名称到数据的映射
+  std::map<std::string, Field> _fields;
+};
@@ -0,0 +1,167 @@
+/****************************************************************/
+/* BurnupCheckpoint.h                                           */
+/* Binary Burnup Step Checkpoint                                */
+/*                                                              */
+/* Snapshot of named binary sections written in the background */
+/* and read back through a read-only memory mapping.            */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * 燃耗步检查点文件
+ * Per-rank checkpoint file of one burnup step.
+ *
+ * 文件格式 (本机字节序):
+ *   文件头 64 字节   magic "RCKPT001", 版本, 段数, 燃耗步, 进程号, 进程数, 段表偏移, 文件长度
+ *   段表  每段 128 字节   段名 (最长 111 字符), 数据偏移, 数据长度
+ *   数据  每段按 64 字节对齐
+ * File layout (native byte order): a 64 byte header (magic "RCKPT001",
+ * version, number of sections, burnup step, rank, number of ranks, section
+ * table offset, file size), a table of 128 byte entries (name of at most 111
+ * characters, data offset, data size) and the section data, each aligned to
+ * 64 bytes. Since every section is aligned, a read-only mapping of the file
+ * can be used in place without copying or parsing.
+ *
+ * 每个进程写自己的一个文件，只保存本进程的场数据。
+ * Every rank writes its own file holding only its local field slices.
+ */
+/**
+ * 检查点写出器
+ * Checkpoint writer.
+ *
+ * add() 立即复制数据，因此之后可以在后台线程调用 write()，计算同时继续修改原数据。
+ * add() copies the data right away, so write() may run on a background thread
+ * while the simulation keeps changing the originals.
+ */
+class BurnupCheckpointWriter
+{
+public:
+  BurnupCheckpointWriter(unsigned int step, processor_id_type rank, processor_id_type n_procs);
+
+  /// 检查点文件名: <base>_<step>.<rank>.ckpt (step 补齐 4 位)
+  static std::string fileName(const std::string & base, unsigned int step, processor_id_type rank);
+
+  /// 加入一段数组
+  template <typename T>
+  void add(const std::string & name, const T * data, std::size_t n)
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "checkpoint sections must be plain data");
+    std::memcpy(reserve(name, n * sizeof(T)), data, n * sizeof(T));
+  }
+
+  template <typename T>
+  void add(const std::string & name, const std::vector<T> & values)
+  {
+    add(name, values.data(), values.size());
+  }
+
+  /// 加入一个值
+  template <typename T>
+  void addValue(const std::string & name, const T & value)
+  {
+    add(name, &value, 1);
+  }
+
+  /// 分配一段并返回其存储 (供 Fortran 直接写入)
+  char * reserve(const std::string & name, std::size_t bytes);
+
+  /**
+   * 写出文件：先写 <file>.tmp 再改名，写到一半的文件不会被当作检查点
+   * Writes <file>.tmp and renames it, so a partial file never looks valid.
+   * 失败时抛出 std::runtime_error (可在后台线程调用)。
+   * Throws std::runtime_error on failure (safe on a background thread).
+   */
+  void write(const std::string & file) const;
+
+protected:
+  const unsigned int _step;
+  const processor_id_type _rank;
+  const processor_id_type _n_procs;
+
+  /// 段名与数据 (按加入顺序)
+  std::vector<std::pair<std::string, std::vector<char>>> _sections;
+};
+
+/**
+ * 检查点读取器
+ * Checkpoint reader over a read-only memory mapping of the file.
+ */
+class BurnupCheckpointReader
+{
+public:
+  /// 映射并校验文件 (格式错误时 mooseError)
+  BurnupCheckpointReader(const std::string & file);
+  ~BurnupCheckpointReader();
+
+  BurnupCheckpointReader(const BurnupCheckpointReader &) = delete;
+  BurnupCheckpointReader & operator=(const BurnupCheckpointReader &) = delete;
+
+  unsigned int step() const { return _step; }
+  processor_id_type rank() const { return _rank; }
+  processor_id_type nProcs() const { return _n_procs; }
+
+  /// 是否有该段
+  bool has(const std::string & name) const;
+
+  /// 以 prefix 开头的所有段名
+  std::vector<std::string> sectionNames(const std::string & prefix) const;
+
+  /// 段数据在映射中的位置和长度 (段不存在时 mooseError)
+  const char * data(const std::string & name, std::size_t & bytes) const;
+
+  /// 读取一段数组
+  template <typename T>
+  std::vector<T> read(const std::string & name) const
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "checkpoint sections must be plain data");
+    std::size_t bytes;
+    const char * begin = data(name, bytes);
+    checkSize(name, bytes, sizeof(T), false);
+    std::vector<T> values(bytes / sizeof(T));
+    if (bytes > 0)
+      std::memcpy(values.data(), begin, bytes);
+    return values;
+  }
+
+  /// 读取一个值
+  template <typename T>
+  T value(const std::string & name) const
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "checkpoint sections must be plain data");
+    std::size_t bytes;
+    const char * begin = data(name, bytes);
+    checkSize(name, bytes, sizeof(T), true);
+    T result;
+    std::memcpy(&result, begin, sizeof(T));
+    return result;
+  }
+
+protected:
+  /// 检查段长度与类型一致
+  void checkSize(const std::string & name, std::size_t bytes, std::size_t size, bool single) const;
+
+  const std::string _file;
+
+  /// 文件映射
+  const char * _map;
+  std::size_t _map_size;
+
+  unsigned int _step;
+  processor_id_type _rank;
+  processor_id_type _n_procs;
+
+  /// 段名到 (偏移, 长度)
+  std::vector<std::pair<std::string, std::pair<std::size_t, std::size_t>>> _sections;
+};
@@ -0,0 +1,101 @@
+/****************************************************************/
+/* BurnupStepController.h                                       */
+/* Adaptive Burnup Interval and Power Extrapolation             */
+/*                                                              */
+/* Chooses the length of the next depletion interval from the   */
+/* predictor-corrector discrepancy and extrapolates the power   */
+/* field from earlier steps.                                    */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/parallel.h"
+
+#include <deque>
+#include <vector>
+
+class BurnupCheckpointWriter;
+class BurnupCheckpointReader;
+
+/**
+ * 燃耗步长控制与功率外推
+ * Adaptive depletion interval and power extrapolation.
+ *
+ * 预估-校正差异 e 为二阶量，下一步长取 dt * clamp(0.9 * sqrt(tol / e), 0.2, growth)，
+ * 并限制在 [dt_min, dt_max] 内。已接受的燃耗步按燃耗值保存功率场 (最多 3 个)，
+ * 用于线性或二次 Lagrange 外推；外推与预估结果足够接近时可以跳过校正步。
+ * The predictor-corrector discrepancy e is second order in the interval, so
+ * the next interval is dt * clamp(0.9 * sqrt(tol / e), 0.2, growth) bounded
+ * by [dt_min, dt_max]. Accepted steps keep their power field against burnup
+ * (at most 3) for linear or quadratic Lagrange extrapolation; when the
+ * extrapolation agrees with the predictor the corrector can be skipped.
+ *
+ * 场是各进程本地的一段，差异通过通信器做全局归约。
+ * Fields are rank-local slices; differences are reduced over the communicator.
+ */
+class BurnupStepController
+{
+public:
+  /**
+   * @param comm 用于全局归约的通信器
+   * @param interval 初始燃耗步长 (天)
+   * @param interval_min 最小步长
+   * @param interval_max 最大步长
+   * @param tolerance 目标预估-校正相对差异 (为 0 时不调整步长)
+   * @param growth 每步最大增长倍数
+   * @param order 外推阶数 (0 不外推, 1 线性, 2 二次)
+   */
+  BurnupStepController(const libMesh::Parallel::Communicator & comm,
+                       Real interval,
+                       Real interval_min,
+                       Real interval_max,
+                       Real tolerance,
+                       Real growth,
+                       unsigned int order);
+
+  /// 下一个燃耗步的步长
+  Real interval() const { return _interval; }
+
+  /**
+   * 由之前的燃耗步外推功率场
+   * @param burnup 目标燃耗值
+   * @param values 返回外推值
+   * @return 历史足够且外推可用 (所有进程一致)
+   */
+  bool extrapolate(Real burnup, std::vector<Real> & values) const;
+
+  /// 全局 L2 相对差异 ||a - b|| / ||a|| (长度不一致时为最大值)
+  Real relativeDifference(const std::vector<Real> & a, const std::vector<Real> & b) const;
+
+  /**
+   * 接受一个燃耗步并调整下一步长
+   * @param burnup 步末燃耗值
+   * @param power 步末功率场
+   * @param error 本步的差异估计 (小于 0 时不调整步长)
+   */
+  void accept(Real burnup, const std::vector<Real> & power, Real error);
+
+  /// 把步长和外推历史写入检查点 (burnup/interval, burnup/history/<i>/...)
+  void save(BurnupCheckpointWriter & writer) const;
+
+  /// 从检查点恢复步长和外推历史
+  void restore(const BurnupCheckpointReader & reader);
+
+protected:
+  const libMesh::Parallel::Communicator & _comm;
+
+  Real _interval;
+  const Real _interval_min;
+  const Real _interval_max;
+  const Real _tolerance;
+  const Real _growth;
+  const unsigned int _order;
+
+  /// 之前燃耗步的燃耗值与功率场
+  std::deque<std::pair<Real, std::vector<Real>>> _history;
+};
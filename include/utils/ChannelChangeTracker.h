@@ -0,0 +1,69 @@
+/****************************************************************/
+/* ChannelChangeTracker.h                                       */
+/* Per-Channel Change Tracking of a Structured Field            */
+/*                                                              */
+/* Marks the (i,j) channels of a lexicographic box whose        */
+/* values moved since they were last handed to a solver.        */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <vector>
+
+/**
+ * 结构网格场的逐通道变化跟踪
+ * Per-channel change tracking of a field on a structured box.
+ *
+ * 通道是字典序子块 l = i + nx*(j + ny*k) 中 (i,j) 相同的一列点。每个通道保存
+ * 上一次被求解时的参考值；update 把任一点变化超过 threshold * max|参考值| 的通道
+ * 标记为活动，并只更新活动通道的参考值，因此缓慢的漂移会累积到超过阈值为止。
+ * A channel is the column of points sharing (i,j) in the lexicographic box
+ * l = i + nx*(j + ny*k). Every channel keeps the values it was last solved
+ * with; update marks the channels in which any point moved by more than
+ * threshold * max|reference| and only refreshes the references of those, so
+ * slow drifts accumulate until they cross the threshold.
+ *
+ * 每个通道还记录上一次求解的内迭代容差，比当前容差宽松的通道同样标记为活动。
+ * Every channel also records the inner tolerance it was last solved to, and
+ * channels solved more loosely than the current tolerance are marked as well.
+ */
+class ChannelChangeTracker
+{
+public:
+  /**
+   * @param dims 本地子块的维度 (nx, ny, nz)
+   * @param threshold 相对于参考场最大值的变化阈值
+   */
+  ChannelChangeTracker(const std::vector<int> & dims, Real threshold);
+
+  /// 通道数 (nx*ny)
+  std::size_t numChannels() const { return _n_channels; }
+
+  /**
+   * 标记变化的通道并更新其参考值
+   * @param values 当前场 (字典序)
+   * @param tolerance 本次求解的内迭代容差
+   * @param active 返回每个通道的标记 (1 为需要求解)
+   * @return 活动通道数
+   */
+  std::size_t update(const Real * values, Real tolerance, int * active);
+
+  /// 丢弃参考值，下一次 update 标记所有通道
+  void reset() { _reference.clear(); }
+
+protected:
+  const std::size_t _n_channels;
+  const std::size_t _size;
+  const Real _threshold;
+
+  /// 每个点上一次求解时的值 (为空表示尚未求解)
+  std::vector<Real> _reference;
+
+  /// 每个通道上一次求解的内迭代容差
+  std::vector<Real> _tolerance;
+};
@@ -0,0 +1,105 @@
+/****************************************************************/
+/* CouplingPerfLog.h                                            */
+/* Per-Burnup-Step Performance Report                           */
+/*                                                              */
+/* Accumulates the wall time of the coupling phases and writes  */
+/* one CSV row per burnup step.                                 */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/parallel.h"
+
+#include <array>
+#include <chrono>
+#include <fstream>
+
+/**
+ * 每个燃耗步的性能报告
+ * Per-burnup-step performance report.
+ *
+ * 记录每个燃耗步中子学、热工、松弛以及 (JACOBI 格式) 并行执行阶段的墙钟时间（所有进程中的最大值）、
+ * 耦合迭代次数和内迭代次数，由主进程写成 CSV。文件名为空时不做任何事。
+ * Records the wall time of the neutronics, thermal, relaxation and (JACOBI)
+ * concurrent phases of every burnup step (maximum over the ranks) together with the coupling and
+ * inner iteration counts; rank 0 writes them as CSV. With an empty file name
+ * the log is disabled and the timers do nothing.
+ */
+class CouplingPerfLog
+{
+public:
+  /// 计时阶段
+  enum Phase
+  {
+    NEUTRONICS = 0,
+    THERMAL,
+    RELAXATION,
+    CONCURRENT, // JACOBI 格式中两个多应用同时执行的时间
+    N_PHASES
+  };
+
+  CouplingPerfLog(const libMesh::Parallel::Communicator & comm, const std::string & file_name);
+
+  /// 是否输出报告
+  bool enabled() const { return _enabled; }
+
+  /// 开始一个燃耗步
+  void beginStep();
+
+  /// 累加一个阶段的时间
+  void addTime(Phase phase, Real seconds) { _times[phase] += seconds; }
+
+  /// 累加内迭代次数
+  void addInnerIterations(unsigned int its) { _inner_its += its; }
+
+  /**
+   * 结束燃耗步并写出一行
+   * @param step 燃耗步
+   * @param coupling_its 耦合迭代次数
+   * @param converged 耦合迭代是否收敛
+   * @param temperature_change 最后一次迭代的温度相对变化
+   * @param power_change 最后一次迭代的功率相对变化
+   */
+  void endStep(unsigned int step,
+               unsigned int coupling_its,
+               bool converged,
+               Real temperature_change,
+               Real power_change);
+
+  /// 作用域计时器：析构时把经过的时间加到对应阶段
+  class ScopedTimer
+  {
+  public:
+    ScopedTimer(CouplingPerfLog & log, Phase phase);
+    ~ScopedTimer();
+
+  private:
+    CouplingPerfLog & _log;
+    const Phase _phase;
+    std::chrono::steady_clock::time_point _start;
+  };
+
+protected:
+  using Clock = std::chrono::steady_clock;
+
+  const libMesh::Parallel::Communicator & _comm;
+
+  const bool _enabled;
+
+  /// 输出文件 (只在主进程打开)
+  std::ofstream _file;
+
+  /// 本燃耗步的开始时间
+  Clock::time_point _step_start;
+
+  /// 本燃耗步各阶段累计时间
+  std::array<Real, N_PHASES> _times;
+
+  /// 本燃耗步的内迭代次数
+  unsigned int _inner_its;
+};
@@ -0,0 +1,157 @@
+/****************************************************************/
+/* FieldExchange.h                                              */
+/* Rank-Local Field Exchange with the Fortran Kernels           */
+/*                                                              */
+/* Exposes the locally owned DOFs of a MOOSE variable to the    */
+/* Fortran solvers without per-DOF virtual get/set calls.       */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/point.h"
+
+#include <vector>
+
+class SystemBase;
+class MooseVariableFieldBase;
+
+namespace libMesh
+{
+template <typename T>
+class PetscVector;
+}
+
+/**
+ * 场数据交换器
+ * Field exchange between a MOOSE variable and a contiguous Fortran array.
+ *
+ * 只处理本进程拥有的自由度，因此在 mpiexec -n N 下每个进程只交换自己的那一段。
+ * Only the rank-local part of the solution is exchanged, so every rank hands
+ * its own slice to the kernel when the sub-app runs on several ranks.
+ *
+ * 当变量独占其系统时，直接返回PETSc本地存储的指针（零拷贝）；
+ * 否则使用持久缓冲区，按预先计算的本地偏移一次性聚集/分散。
+ * When the variable is the only one in its system the PETSc local storage is
+ * handed out directly (zero copy). Otherwise, or when a different ordering is
+ * requested, a persistent buffer is filled from precomputed local offsets in
+ * a single blocked gather.
+ */
+class FieldExchange
+{
+public:
+  FieldExchange(MooseVariableFieldBase & var);
+  ~FieldExchange();
+
+  /**
+   * 获取本地数据指针
+   * @param read 是否需要当前解的数值（缓冲模式下决定是否聚集）
+   * @return 长度为 localSize() 的连续数组
+   */
+  Real * open(bool read);
+
+  /**
+   * 释放数据指针
+   * @param write 是否把数组内容写回解向量并更新ghost值
+   */
+  void close(bool write);
+
+  /// 本地自由度数目
+  std::size_t localSize() const { return _local_size; }
+
+  /// 是否直接使用PETSc存储
+  bool isDirect() const { return _direct; }
+
+  /// 本地自由度在解向量本地段中的偏移（直接模式下为空）
+  const std::vector<dof_id_type> & localOffsets() const { return _local_offsets; }
+
+  /**
+   * 按交换数组的顺序返回各自由度所在节点或单元的编号
+   * Node (nodal variables) or element ids of the exchanged entries, in array order.
+   * Used to match the layouts of two sub-apps built on the same mesh.
+   */
+  void localDofObjectIds(std::vector<dof_id_type> & ids) const;
+
+  /// 按交换数组的顺序返回各自由度的坐标（节点坐标或单元顶点平均）
+  void localDofObjectPoints(std::vector<Point> & points) const;
+
+  /**
+   * 设置交换数组的顺序（例如结构网格的字典序），只能设置一次
+   * Reorder the exchanged array, e.g. to lexicographic (i,j,k) order.
+   * @param order 新顺序第p个位置对应的原自然顺序下标
+   */
+  void setOrdering(const std::vector<dof_id_type> & order);
+
+  /**
+   * 按结构网格的字典序 (i,j,k) 交换数据
+   * Switch to lexicographic (i,j,k) order on a structured grid of mesh_dims.
+   * 网格没有按 z 方向分块分区时保留自由度顺序并返回空数组 (所有进程一致)
+   * Without a z-slab partition the DOF order is kept and an empty vector is
+   * returned (on all ranks).
+   * @return 本进程子块的维度 (nx, ny, nz_local)
+   */
+  std::vector<int> useStructuredOrdering(const std::vector<int> & mesh_dims);
+
+  /**
+   * 只使用连续缓冲区：把当前数值聚集一次，之后 open/close 不再访问解向量
+   * Keep the field in the contiguous buffer only: the current values are
+   * gathered once, after which open/close no longer touch the solution vector.
+   * 多个实例共享同一个主应用变量的布局时，每个实例用这种方式保存自己的场。
+   * Used when several instances share the layout of one parent variable and
+   * each keeps its own field.
+   */
+  void detach();
+
+  /// 是否只使用缓冲区
+  bool isDetached() const { return _detached; }
+
+protected:
+  /// 按自然顺序或设置的顺序收集节点/单元编号与坐标
+  void collectLocalDofObjects(std::vector<dof_id_type> * ids, std::vector<Point> * points) const;
+
+  /// 获取PETSc本地数组
+  Real * localArray();
+
+  /// 归还PETSc本地数组
+  void restoreLocalArray();
+
+  /// 变量所在系统
+  SystemBase & _sys;
+
+  /// 变量编号
+  const unsigned int _var_num;
+
+  /// 解向量（PETSc实现）
+  libMesh::PetscVector<Number> * _petsc_solution;
+
+  /// 是否零拷贝
+  bool _direct;
+
+  /// 是否只使用缓冲区
+  bool _detached;
+
+  /// 变量是否覆盖整个本地段
+  bool _covers_local_range;
+
+  /// 本地自由度数目
+  std::size_t _local_size;
+
+  /// 缓冲模式下各自由度在本地段中的偏移
+  std::vector<dof_id_type> _local_offsets;
+
+  /// 覆盖整个本地段时写回使用的逆排列
+  std::vector<dof_id_type> _scatter_offsets;
+
+  /// 设置的顺序（为空时为自然顺序）
+  std::vector<dof_id_type> _ordering;
+
+  /// 持久缓冲区，只分配一次
+  std::vector<Real> _buffer;
+
+  /// 是否已打开
+  bool _is_open;
+};
@@ -0,0 +1,132 @@
+/****************************************************************/
+/* FieldHistoryWriter.h                                         */
+/* Asynchronous Append-Only Field History                       */
+/*                                                              */
+/* Queues snapshots of the coupled fields and appends them to   */
+/* a compact per-rank binary file on a background thread.       */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/parallel.h"
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * 场历史写出器
+ * Asynchronous writer of the field history.
+ *
+ * append() 只把快照放进队列，后台线程负责转换精度和写盘，因此求解循环不等待磁盘；
+ * 队列中已有 max_pending 个快照时 append() 才会等待，以限制内存。
+ * append() only queues the snapshot; a background thread converts and writes
+ * it, so the solve loop does not wait for the disk. append() blocks only when
+ * max_pending snapshots are already queued, which bounds the memory.
+ *
+ * 每个进程写自己的文件 <base>.<rank>.fhist，只追加 (本机字节序):
+ *   文件头 32 字节   magic "RFHIST01", 版本, 进程号, 进程数, 数值字节数 (4 或 8)
+ *   每个快照         记录长度 (uint64, 不含自身), 燃耗步, 耦合迭代, 时间, 场数,
+ *                    然后每个场: 名称长度, 数值个数, 名称, 数值
+ * Every rank appends to its own file <base>.<rank>.fhist (native byte order):
+ * a 32 byte header (magic "RFHIST01", version, rank, number of ranks, bytes
+ * per value) followed by one record per snapshot (record length, step,
+ * coupling iteration, time, number of fields, then per field the name length,
+ * value count, name and values). Each record is flushed as a whole, so an
+ * interrupted run leaves at most one incomplete record at the end, which
+ * read() ignores.
+ *
+ * 文件名为空时不做任何事。
+ * With an empty base name the writer is disabled.
+ */
+class FieldHistoryWriter
+{
+public:
+  /// 一个快照
+  struct Snapshot
+  {
+    unsigned int step = 0;
+
+    /// 耦合迭代 (0 表示燃耗步结束时的场)
+    unsigned int iteration = 0;
+
+    Real time = 0.0;
+
+    /// 场名称与本地数值
+    std::vector<std::pair<std::string, std::vector<Real>>> fields;
+  };
+
+  /**
+   * @param comm 通信器 (决定文件名中的进程号)
+   * @param file_base 文件名前缀 (为空时不写)
+   * @param single_precision 以单精度保存数值
+   * @param append 追加到已有文件 (重启时)，否则覆盖
+   * @param max_pending 队列中最多的快照数
+   */
+  FieldHistoryWriter(const libMesh::Parallel::Communicator & comm,
+                     const std::string & file_base,
+                     bool single_precision,
+                     bool append,
+                     unsigned int max_pending = 4);
+
+  ~FieldHistoryWriter();
+
+  FieldHistoryWriter(const FieldHistoryWriter &) = delete;
+  FieldHistoryWriter & operator=(const FieldHistoryWriter &) = delete;
+
+  /// 是否写出
+  bool enabled() const { return _enabled; }
+
+  /// 把快照放进写出队列
+  void append(Snapshot && snapshot);
+
+  /// 等待队列中的快照全部写出
+  void flush();
+
+  /// 场历史文件名: <base>.<rank>.fhist
+  static std::string fileName(const std::string & base, processor_id_type rank);
+
+  /// 读取一个场历史文件中的所有完整快照
+  static std::vector<Snapshot> read(const std::string & file);
+
+protected:
+  /// 后台线程：依次写出队列中的快照
+  void writeLoop();
+
+  /// 写出一个快照
+  void writeSnapshot(const Snapshot & snapshot);
+
+  /// 报告后台线程中的错误
+  void checkError();
+
+  const bool _enabled;
+  const bool _single_precision;
+  const unsigned int _max_pending;
+  std::string _file_name;
+
+  std::ofstream _file;
+
+  /// 待写出的快照和后台线程的状态 (由 _mutex 保护)
+  std::deque<Snapshot> _queue;
+  bool _writing;
+  bool _stop;
+  std::string _error;
+
+  std::mutex _mutex;
+  std::condition_variable _queued;
+  std::condition_variable _written;
+  std::thread _thread;
+
+  /// 写出一个记录的工作缓冲区 (只在后台线程中使用)
+  std::vector<char> _record;
+};
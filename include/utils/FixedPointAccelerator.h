@@ -0,0 +1,99 @@
+/****************************************************************/
+/* FixedPointAccelerator.h                                      */
+/* Relaxation and Acceleration for Coupling Iterations          */
+/*                                                              */
+/* Computes the next input of a fixed-point iteration x=G(x)    */
+/* with constant, Aitken dynamic or Anderson mixing.            */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/parallel.h"
+
+#include <deque>
+#include <vector>
+
+/**
+ * 固定点迭代加速器
+ * Fixed-point accelerator for the neutronics-thermal coupling loop.
+ *
+ * 向量为各进程本地的一段，内积通过通信器做全局归约，因此在多进程下结果一致。
+ * Vectors are the rank-local slices of a distributed field; inner products are
+ * reduced over the communicator so every rank takes the same decision.
+ */
+class FixedPointAccelerator
+{
+public:
+  /// 松弛方法
+  enum class Method
+  {
+    CONSTANT,
+    AITKEN,
+    ANDERSON
+  };
+
+  /**
+   * @param comm 用于全局归约的通信器
+   * @param method 松弛方法
+   * @param relaxation_factor 常数松弛因子 (Aitken为初始因子, Anderson为混合因子)
+   * @param depth Anderson 历史深度
+   */
+  FixedPointAccelerator(const libMesh::Parallel::Communicator & comm,
+                        Method method,
+                        Real relaxation_factor,
+                        unsigned int depth);
+
+  /// 清空历史 (每个燃耗步开始时调用)
+  void reset();
+
+  /**
+   * 计算下一次迭代的输入
+   * @param input  本次迭代的输入 x_k
+   * @param output 输入 G(x_k)，返回时被替换为 x_{k+1}
+   */
+  void accelerate(const std::vector<Real> & input, std::vector<Real> & output);
+
+  /// 当前松弛因子 (用于输出)
+  Real relaxationFactor() const { return _omega; }
+
+  /// 当前Anderson历史长度
+  std::size_t historySize() const { return _delta_f.size(); }
+
+protected:
+  /// Anderson 混合，历史不可用时退化为常数松弛
+  void andersonMixing(const std::vector<Real> & input, std::vector<Real> & output);
+
+  const libMesh::Parallel::Communicator & _comm;
+
+  const Method _method;
+
+  /// 用户给定的松弛因子
+  const Real _relaxation_factor;
+
+  /// Anderson 历史深度
+  const unsigned int _depth;
+
+  /// 当前松弛因子
+  Real _omega;
+
+  /// 上一次的残差 f_{k-1} = G(x_{k-1}) - x_{k-1}
+  std::vector<Real> _prev_residual;
+
+  /// 上一次的输入 x_{k-1}
+  std::vector<Real> _prev_input;
+
+  /// 是否已有上一次迭代
+  bool _has_previous;
+
+  /// Anderson 残差差分 ΔF 与输入差分 ΔX
+  std::deque<std::vector<Real>> _delta_f;
+  std::deque<std::vector<Real>> _delta_x;
+
+  /// 当前残差的工作数组
+  std::vector<Real> _residual;
+};
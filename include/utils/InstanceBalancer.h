@@ -0,0 +1,74 @@
+/****************************************************************/
+/* InstanceBalancer.h                                           */
+/* Cost-Based Placement of Sub-App Instances                    */
+/*                                                              */
+/* Orders the positions of a multiapp so that the contiguous    */
+/* blocks MOOSE hands to every rank carry similar solver cost.  */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/parallel.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * 子应用实例的负载均衡
+ * Cost-based placement of the instances of a multiapp.
+ *
+ * MOOSE 按数目把子应用连续地分给各进程（前 n_apps % n_procs 个进程多一个），
+ * 因此只能通过重排 positions 来决定哪些实例落在同一个进程上。按代价从大到小，
+ * 每个实例放到当前负载最小且仍有空位的进程组，最后把各组依次拼接。
+ * MOOSE gives every rank a contiguous block of apps by count (the first
+ * n_apps % n_procs ranks take one extra), so placement can only be controlled
+ * by permuting the positions. Instances are assigned in descending cost to
+ * the least loaded group that still has room (LPT), and the groups are then
+ * concatenated in rank order.
+ *
+ * 代价文件每行为 "position_index cost"，由上一次运行测得的每实例求解时间写出。
+ * The cost file holds "position_index cost" lines written from the per
+ * instance kernel time measured by a previous run.
+ */
+class InstanceBalancer
+{
+public:
+  /**
+   * @param costs 每个位置的代价 (按原始位置编号)
+   * @param n_groups 进程组数目
+   */
+  InstanceBalancer(const std::vector<Real> & costs, unsigned int n_groups);
+
+  /// 新顺序中第 i 个应用对应的原始位置编号
+  const std::vector<unsigned int> & order() const { return _order; }
+
+  /// 各组的总代价
+  const std::vector<Real> & groupCosts() const { return _group_costs; }
+
+  /// 最大组代价与平均组代价之比 (1 表示完全均衡)
+  Real imbalance() const;
+
+  /// MOOSE 分给每个进程组的应用数目
+  static std::vector<unsigned int> groupSizes(unsigned int n_items, unsigned int n_groups);
+
+  /// 在 0 号进程读取代价文件并广播 (文件不存在时返回空)
+  static std::vector<Real> readCosts(const std::string & file_name,
+                                     const libMesh::Parallel::Communicator & comm);
+
+  /// 在 0 号进程写出代价文件
+  static void writeCosts(const std::string & file_name,
+                         const std::vector<Real> & costs,
+                         const libMesh::Parallel::Communicator & comm);
+
+protected:
+  /// 新顺序到原始位置
+  std::vector<unsigned int> _order;
+
+  /// 各组总代价
+  std::vector<Real> _group_costs;
+};
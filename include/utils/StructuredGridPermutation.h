@@ -0,0 +1,90 @@
+/****************************************************************/
+/* StructuredGridPermutation.h                                  */
+/* DOF to Lexicographic (i,j,k) Permutation                     */
+/*                                                              */
+/* Maps the rank-local entries of a field on a structured       */
+/* nx*ny*nz grid to the i-fastest order used by the Fortran     */
+/* stencil kernels.                                             */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/parallel.h"
+#include "libmesh/point.h"
+
+#include <array>
+#include <vector>
+
+/**
+ * 结构网格自由度排列
+ * Permutation from libMesh DOF order to lexicographic (i,j,k) order.
+ *
+ * 每个方向上的坐标值在所有进程间汇总后排序，(i,j,k) 为坐标在各方向上的序号，
+ * 因此也支持非均匀的张量积网格。字典序编号为 l = i + nx*(j + ny*k)。
+ * The distinct coordinates of every direction are gathered over all ranks and
+ * sorted; (i,j,k) are the positions in those lists, so non-uniform tensor
+ * grids are supported. The lexicographic index is l = i + nx*(j + ny*k).
+ *
+ * 多进程时只有每个进程的本地数据都是完整的若干个 k 平面（例如使用
+ * StructuredSlabPartitioner 分区）时，每个进程交给求解器的才是一个
+ * nx*ny*nz_local 的子块；否则 isSlab() 在所有进程上返回 false，调用者应保留
+ * 自由度顺序。
+ * On several ranks the local entries only form an nx*ny*nz_local box when
+ * every rank owns whole k-planes (e.g. a StructuredSlabPartitioner mesh);
+ * otherwise isSlab() is false on all ranks and the caller should keep the DOF
+ * order.
+ */
+class StructuredGridPermutation
+{
+public:
+  /**
+   * @param points 本地数据点的坐标 (按交换数组顺序)
+   * @param mesh_dims 全局网格维度 (nx, ny, nz)
+   * @param comm 子应用的通信器
+   */
+  StructuredGridPermutation(const std::vector<Point> & points,
+                            const std::vector<int> & mesh_dims,
+                            const libMesh::Parallel::Communicator & comm);
+
+  /// 字典序位置 p 对应的原始数组下标
+  const std::vector<dof_id_type> & order() const { return _order; }
+
+  /// 原始顺序已经是字典序
+  bool isIdentity() const { return _identity; }
+
+  /// 所有进程的本地数据都是连续的完整 k 平面
+  bool isSlab() const { return _slab; }
+
+  /// 本地子块的维度 (nx, ny, nz_local)，只在 isSlab() 时有意义
+  const std::vector<int> & localDims() const { return _local_dims; }
+
+  /// 本地子块第一个数据的全局字典序编号
+  dof_id_type firstIndex() const { return _first_index; }
+
+protected:
+  /// 汇总一个方向上的所有不同坐标
+  std::vector<Real> globalCoordinates(const std::vector<Point> & points,
+                                      unsigned int dim,
+                                      Real tol,
+                                      const libMesh::Parallel::Communicator & comm) const;
+
+  /// 字典序位置到原始下标
+  std::vector<dof_id_type> _order;
+
+  /// 是否恒等排列
+  bool _identity;
+
+  /// 是否按 z 方向分块
+  bool _slab;
+
+  /// 本地子块维度
+  std::vector<int> _local_dims;
+
+  /// 本地子块起始编号
+  dof_id_type _first_index;
+};
@@ -0,0 +1,81 @@
+/****************************************************************/
+/* StructuredGridTransfer.h                                     */
+/* Restriction and Prolongation on Structured Grids             */
+/*                                                              */
+/* Moves lexicographic fields of an nx*ny*nz box to a grid      */
+/* coarsened by an integer factor in every direction and back.  */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <array>
+#include <vector>
+
+/**
+ * 结构网格的限制与延拓
+ * Restriction and prolongation between a structured box and its coarsening.
+ *
+ * 每个方向上粗网格点 I 位于细网格点 min(I*factor, n-1)，因此两端的点总是保留，
+ * 粗网格维度为 ceil((n-1)/factor)+1。延拓为三线性插值；限制为延拓的转置
+ * 按列归一化后的加权平均 (full weighting)，二者都保持常数场。
+ * In every direction coarse point I sits on fine point min(I*factor, n-1), so
+ * both ends are kept and the coarse size is ceil((n-1)/factor)+1. Prolongation
+ * is trilinear interpolation; restriction is the transpose of it with every
+ * column normalised (full weighting). Both keep constant fields unchanged.
+ *
+ * 数据按字典序 l = i + nx*(j + ny*k) 存放，与交给 Fortran 求解器的本地子块相同。
+ * Fields are stored in the lexicographic order l = i + nx*(j + ny*k) of the
+ * rank-local box handed to the Fortran kernels.
+ */
+class StructuredGridTransfer
+{
+public:
+  /**
+   * @param fine_dims 细网格本地子块的维度 (nx, ny, nz)
+   * @param factor 每个方向上的粗化系数
+   */
+  StructuredGridTransfer(const std::vector<int> & fine_dims, unsigned int factor);
+
+  /// 细网格维度
+  const std::vector<int> & fineDims() const { return _fine_dims; }
+
+  /// 粗网格维度
+  const std::vector<int> & coarseDims() const { return _coarse_dims; }
+
+  /// 细网格与粗网格的数据点数
+  std::size_t fineSize() const { return _fine_size; }
+  std::size_t coarseSize() const { return _coarse_size; }
+
+  /// 把细网格场限制到粗网格
+  void restrictField(const Real * fine, Real * coarse) const;
+
+  /// 把粗网格场延拓到细网格
+  void prolongField(const Real * coarse, Real * fine) const;
+
+protected:
+  /// 一个方向上细网格点的插值：左右粗网格点及右侧权重
+  struct Axis
+  {
+    std::vector<int> left;
+    std::vector<int> right;
+    std::vector<Real> weight;
+
+    /// 每个粗网格点的权重和 (限制时归一化)
+    std::vector<Real> column_sum;
+  };
+
+  /// 建立一个方向的插值表
+  static Axis buildAxis(int n, unsigned int factor, int & n_coarse);
+
+  std::vector<int> _fine_dims;
+  std::vector<int> _coarse_dims;
+  std::size_t _fine_size;
+  std::size_t _coarse_size;
+
+  std::array<Axis, 3> _axes;
+};
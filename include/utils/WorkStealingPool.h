@@ -0,0 +1,93 @@
+/****************************************************************/
+/* WorkStealingPool.h                                           */
+/* Work-Stealing Thread Pool for Sub-App Kernels                */
+/*                                                              */
+/* Runs independent Fortran solves of the local sub-app         */
+/* instances concurrently within one MPI rank.                  */
+/*                                                              */
+/* Created: Oct 16, 2026                                        */
+/* Last Modified: Oct 16, 2026                                  */
+/****************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * 工作窃取线程池
+ * Work-stealing thread pool for the independent instance solves of a rank.
+ *
+ * 每个线程有自己的任务队列，从队首取任务；自己的队列为空时从其他线程的队尾窃取，
+ * 因此代价不均的实例也能在线程间自动均衡。调用 run() 的线程本身也参与计算。
+ * Every thread owns a task deque and pops from its front; an idle thread
+ * steals from the back of the others, so instances of uneven cost balance
+ * themselves. The thread calling run() takes part as worker 0.
+ *
+ * 与 MPI 一起使用：任务中不得调用 MPI、PETSc 或 MOOSE，只运行 Fortran 求解器；
+ * 所有通信都在调用线程上进行 (MPI_THREAD_FUNNELED 即可)。
+ * With MPI: tasks must not call MPI, PETSc or MOOSE and only run the Fortran
+ * kernels; all communication stays on the calling thread, so
+ * MPI_THREAD_FUNNELED is sufficient.
+ */
+class WorkStealingPool
+{
+public:
+  /// @param n_threads 线程总数 (包括调用线程)
+  explicit WorkStealingPool(unsigned int n_threads);
+  ~WorkStealingPool();
+
+  WorkStealingPool(const WorkStealingPool &) = delete;
+  WorkStealingPool & operator=(const WorkStealingPool &) = delete;
+
+  /// 线程总数
+  unsigned int size() const { return _queues.size(); }
+
+  /**
+   * 执行 task(0) ... task(n_tasks - 1) 并等待全部完成
+   * 任务中抛出的第一个异常在调用线程上重新抛出
+   * Runs every task and returns when all are done; the first exception thrown
+   * by a task is rethrown on the calling thread.
+   */
+  void run(std::size_t n_tasks, const std::function<void(std::size_t)> & task);
+
+protected:
+  /// 一个线程的任务队列
+  struct Queue
+  {
+    std::mutex mutex;
+    std::deque<std::size_t> tasks;
+  };
+
+  /// 工作线程的主循环
+  void workerLoop(unsigned int worker);
+
+  /// 执行队列中的任务，直到所有队列为空
+  void drain(unsigned int worker);
+
+  /// 从自己的队首或其他队列的队尾取一个任务
+  bool nextTask(unsigned int worker, std::size_t & task);
+
+  std::vector<std::unique_ptr<Queue>> _queues;
+  std::vector<std::thread> _threads;
+
+  /// 当前批次的任务
+  const std::function<void(std::size_t)> * _task;
+
+  /// 批次编号、剩余任务数和停止标志 (由 _mutex 保护)
+  std::mutex _mutex;
+  std::condition_variable _start;
+  std::condition_variable _done;
+  unsigned long _generation;
+  std::size_t _remaining;
+  bool _stop;
+
+  /// 任务中的第一个异常
+  std::exception_ptr _error;
+};
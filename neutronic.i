@@ -25,9 +25,40 @@
     fixed_point_min_its = 3
     fixed_point_tol = 1e-6
     accept_on_max_iteration = true
+
+    # 温度场松弛与收敛判据
+    relaxation_type = AITKEN
+    relaxation_factor = 0.7
+    convergence_norm = L2
+
+    # 多重网格耦合: 前几次迭代在 mesh_dims 每个方向粗化 2 倍的网格上求解
+    # (5x5x5 -> 3x3x3)，再以延拓的结果在细网格上完成最后一两次迭代
+    # coarse_factor = 2
+    # coarse_max_its = 4
+    # coarse_rel_tol = 1e-3
+
+    # 收敛判断和松弛直接作用在兄弟多应用之间的通道上
+    field_channel = field_channel
+
+    # GAUSS_SEIDEL: 先中子学后热工; JACOBI: 两者同时运行 (需要 field_channel)
+    coupling_scheme = GAUSS_SEIDEL
+
+    # 控制台输出级别与每个燃耗步的性能报告 (CSV)
+    log_level = SUMMARY
+    perf_log = coupling_perf.csv
+
+    # 功率场和温度场的历史在后台线程写出 (field_history.<rank>.fhist)
+    field_history = field_history
+    field_history_step_interval = 1
+    field_history_iteration_interval = 0
     
     execute_on = 'TIMESTEP_BEGIN'
   []
+
+  # 中子学与热工多应用之间直接交换功率场和温度场，不再经过主应用
+  [field_channel]
+    type = ReactorFieldChannel
+  []
 []
 
 [MultiApps]
@@ -35,9 +66,10 @@
     type = NeutronicsMultiApp
     app_type = MooseprojectsApp
     input_files = 'scapn_input.i'
-    mesh_dims = '4 4 4'          
+    mesh_dims = '5 5 5'
     power_var_name = power_density  
     temperature_var_name = temperature  
+    field_channel = field_channel
     execute_on = 'NEUTRONIC PRENEUTRONIC CORNEUTRONIC'
     # execute_on = 'MULTIAPP_FIXED_POINT_BEGIN' 
   []
@@ -46,21 +78,31 @@
     type = ThermalMultiApp
     app_type = MooseprojectsApp
     input_files = 'thermal_input.i'
-    mesh_dims = '4 4 4'           
+    mesh_dims = '5 5 5'
     power_var_name = power_density  
     temperature_var_name = temperature  
-    execute_on = 'THERMAL'            
+    field_channel = field_channel
+    # 只重新求解功率变化超过本地最大功率 1e-4 的 (i,j) 通道
+    # power_change_threshold = 1e-4
+    execute_on = 'THERMAL'
     # execute_on = 'MULTIAPP_FIXED_POINT_BEGIN'
   []
 []
 
+# 子应用也可以直接使用主应用网格上的 power_density 和 temperature，
+# 子应用输入只剩一个单元的网格，下面两个 Transfers 也不再需要:
+#   input_files = 'lean_subapp.i'
+#   use_parent_mesh = true
+# 多个 positions 时每个实例各自保存场 (需要 field_channel，且只能单进程运行)
+
+# 主应用中的功率场和温度场只用于输出，每个时间步结束时复制一次
 [Transfers]
   [from_neutronics]
     type = ReactorTransfer
     from_multi_app = neutronics
     source_variable = power_density
     variable = power_density
-    #execute_on = 'FROM_NEUTRONIC'       
+    execute_on = 'TIMESTEP_END'
   []
 []
 # [Transfers]
@@ -79,29 +121,25 @@
     from_multi_app = thermal
     source_variable = temperature
     variable = temperature
-    #execute_on = 'FROM_NEUTRONIC TIMESTEP_END'       
-  []
-[]
-
-[Transfers]
-  [to_neutronics]
-    type = MultiAppCopyTransfer
-    to_multi_app = neutronics
-    source_variable = temperature
-    variable = temperature
-    #execute_on = 'FROM_NEUTRONIC TIMESTEP_END'       
+    execute_on = 'TIMESTEP_END'
   []
 []
 
-[Transfers]
-  [to_thermal]
-    type = MultiAppCopyTransfer
-    to_multi_app = thermal
-    source_variable = power_density
-    variable = power_density
-    #execute_on = 'FROM_NEUTRONIC TIMESTEP_END'       
-  []
-[]
+# 经过主应用的传输路径，仅在不使用 field_channel 时需要
+# [Transfers]
+#   [to_neutronics]
+#     type = MultiAppCopyTransfer
+#     to_multi_app = neutronics
+#     source_variable = temperature
+#     variable = temperature
+#   []
+#   [to_thermal]
+#     type = MultiAppCopyTransfer
+#     to_multi_app = thermal
+#     source_variable = power_density
+#     variable = power_density
+#   []
+# []
 
 
 [Kernels]
@@ -136,6 +174,28 @@
   solve = False
 []
 
+# 燃耗步也可以由 BurnupExecutioner 直接驱动 (此时去掉 coupling_control)，
+# 主问题的后处理器和输出只在 output_interval 指定的燃耗步执行:
+# [Executioner]
+#   type = BurnupExecutioner
+#   calc_type = COUPLED
+#   max_burn_steps = 2
+#   fixed_point_max_its = 5
+#   fixed_point_min_its = 3
+#   relaxation_type = AITKEN
+#   relaxation_factor = 0.7
+#   field_channel = field_channel
+#   output_interval = 1
+#   # 自适应燃耗步长，外推足够准确时跳过校正步
+#   # power_level = 3000
+#   # heavy_metal_mass = 80
+#   # adaptive_interval = true
+#   # extrapolation = QUADRATIC
+#   # 每 5 个燃耗步写一个检查点；restart_step 从该步的检查点继续
+#   # checkpoint_interval = 5
+#   # restart_step = 30
+# []
+
 [Executioner]
   type = Transient
   
@@ -218,6 +278,7 @@
   console = true
   csv = true
   exodus = true
+  perf_graph = true
   
   [console]
     type = Console
@@ -9,10 +9,50 @@ module reactor_interfaces
   use iso_c_binding
   implicit none
 
+  ! 求解器状态：由 C++ 端通过不透明句柄持有，跨调用保留上一次的解
+  ! Solver state owned by the C++ side through an opaque handle; it keeps the
+  ! previous solution between calls so that every solve is warm-started.
+  ! 模块中没有可变的全局变量：不同句柄的求解可以在不同线程上同时进行。
+  ! The module holds no mutable global data, so solves on different handles
+  ! may run concurrently on different threads.
+  type :: b1_state
+    integer :: field_size = 0
+    integer :: mesh_dims(3) = 0
+    logical :: initialized = .false.
+    real(c_double) :: keff = 1.0_c_double
+    ! 源项的功率比例和温度反馈系数 (每个句柄/算例一组，不属于求解器状态)
+    ! fission source scale and temperature feedback of this handle (case); they
+    ! are configuration, not solver state, so save/load_state leave them alone
+    real(c_double) :: power_scale = 1.0_c_double
+    real(c_double) :: feedback = 10.0_c_double
+    real(c_double), allocatable :: flux(:)
+  end type b1_state
+
+  type :: thermal_state
+    integer :: field_size = 0
+    integer :: mesh_dims(3) = 0
+    logical :: initialized = .false.
+    real(c_double), allocatable :: temperature(:)
+  end type thermal_state
+
   ! Declare external interfaces
   ! 声明外部接口
   CONTAINS
 
+  ! 可重入的随机数发生器 (Park-Miller minimal standard)：状态由调用者持有，
+  ! 不使用 random_number 的全局状态，因此多个线程可以同时调用各个求解器。
+  ! Reentrant generator whose state is owned by the caller instead of the
+  ! global random_number state, so several threads may run the kernels at once.
+  pure subroutine minstd_random(seed, value)
+    integer, intent(inout) :: seed
+    real(c_double), intent(out) :: value
+
+    integer(8), parameter :: multiplier = 48271_8, modulus = 2147483647_8
+
+    seed = int(mod(multiplier * int(max(seed, 1), 8), modulus))
+    value = real(seed, c_double) / real(modulus, c_double)
+  end subroutine minstd_random
+
 subroutine b1_execute(mesh_dims, power_field, temperature_field, field_size) &
         bind(C, name="b1_execute")
   use iso_c_binding, only: c_int, c_double
@@ -23,6 +63,7 @@ subroutine b1_execute(mesh_dims, power_field, temperature_field, field_size) &
   integer(c_int), intent(in) , value :: field_size
 
   real(c_double) :: random_value
+  integer :: seed
   
   integer :: i
 
@@ -31,8 +72,9 @@ subroutine b1_execute(mesh_dims, power_field, temperature_field, field_size) &
   write(*,*) "  Field size: ", field_size
   
   ! 将power_field的所有元素赋值为300
+  seed = 1 + field_size
   do i = 1, field_size
-    call random_number(random_value)
+    call minstd_random(seed, random_value)
     power_field(i) = 300.0_c_double + 10.0_c_double * random_value
     !write(*,*) "power_field(", i, ") = ", power_field(i)
   end do
@@ -52,6 +94,7 @@ end subroutine
       integer(c_int), intent(in) , value :: field_size
       integer(4)                 :: i
       real(c_double) :: random_value
+      integer :: seed
 
           
       write(*,*) "Executing thermal calculation..."
@@ -60,9 +103,10 @@ end subroutine
           
       ! 简单的热工模型，仅用于演示
       ! 实际应用中应替换为真实的热工分析
+      seed = 2 + field_size
       do i = 1, field_size
         ! 简单假设：温度与功率成正比
-        call random_number(random_value)
+        call minstd_random(seed, random_value)
         temperature_field(i) = 300.0 + 0.01 * power_field(i) * random_value
       end do
       
@@ -98,8 +142,434 @@ end subroutine
     real(c_double), intent(in), value :: power     ! 功率水平 (MW)
     real(c_double), intent(in), value :: time_step  ! 时间步长 (天)
     
-    ! 处理更详细的燃耗信息
-    ! ...
+    ! 处理更详细的燃耗信息：步末累积燃耗、功率水平和本步步长
+    write(*,'(A,I0,A,I0,A,ES12.5,A,ES12.5,A,ES12.5)') &
+         " Fortran: 燃耗步 ", step, "/", max_steps, ", burnup(MWd/tU)=", burnup_value, &
+         ", power(MW)=", power, ", interval(d)=", time_step
   end subroutine update_burnup_detailed
 
-end module
\ No newline at end of file
+  !--------------------------------------------------------------!
+  ! 带状态的求解接口 (Stateful solver interface)                 !
+  !                                                              !
+  ! xxx_create 分配状态并返回句柄，xxx_destroy 释放；xxx_solve   !
+  ! 从上一次的解出发迭代到给定的内迭代容差。                     !
+  ! xxx_create allocates the state and returns the handle,       !
+  ! xxx_destroy frees it; xxx_solve iterates from the previous   !
+  ! solution down to the requested inner tolerance.              !
+  !--------------------------------------------------------------!
+
+  recursive function b1_create(mesh_dims, field_size) result(handle) bind(C, name="b1_create")
+    use iso_c_binding, only: c_int, c_ptr, c_loc
+
+    integer(c_int), intent(in) :: mesh_dims(3)
+    integer(c_int), intent(in), value :: field_size
+    type(c_ptr) :: handle
+
+    type(b1_state), pointer :: state
+
+    allocate(state)
+    state%field_size = field_size
+    state%mesh_dims = mesh_dims
+    allocate(state%flux(max(field_size, 1)))
+    state%flux = 1.0_c_double
+    handle = c_loc(state)
+  end function b1_create
+
+  recursive subroutine b1_destroy(handle) bind(C, name="b1_destroy")
+    use iso_c_binding, only: c_ptr, c_f_pointer, c_associated
+
+    type(c_ptr), intent(in), value :: handle
+    type(b1_state), pointer :: state
+
+    if (.not. c_associated(handle)) return
+    call c_f_pointer(handle, state)
+    if (allocated(state%flux)) deallocate(state%flux)
+    deallocate(state)
+  end subroutine b1_destroy
+
+  ! 丢弃上一次的解，下一次求解从冷启动开始
+  ! drop the previous solution; the next solve starts cold
+  recursive subroutine b1_reset(handle) bind(C, name="b1_reset")
+    use iso_c_binding, only: c_ptr, c_f_pointer
+
+    type(c_ptr), intent(in), value :: handle
+    type(b1_state), pointer :: state
+
+    call c_f_pointer(handle, state)
+    state%flux = 1.0_c_double
+    state%keff = 1.0_c_double
+    state%initialized = .false.
+  end subroutine b1_reset
+
+  ! 设置源项的功率比例和温度反馈系数，保留到句柄释放 (b1_reset 不改变它们)
+  ! set the fission source scale and temperature feedback; they stay until the
+  ! handle is destroyed (b1_reset keeps them)
+  recursive subroutine b1_set_parameters(handle, power_scale, feedback) &
+                      bind(C, name="b1_set_parameters")
+    use iso_c_binding, only: c_double, c_ptr, c_f_pointer
+
+    type(c_ptr), intent(in), value :: handle
+    real(c_double), intent(in), value :: power_scale
+    real(c_double), intent(in), value :: feedback
+    type(b1_state), pointer :: state
+
+    call c_f_pointer(handle, state)
+    state%power_scale = power_scale
+    state%feedback = feedback
+  end subroutine b1_set_parameters
+
+  recursive subroutine b1_solve(handle, mesh_dims, power_field, temperature_field, field_size, &
+                      inner_tol, max_inner_its, inner_its) bind(C, name="b1_solve")
+    use iso_c_binding, only: c_int, c_double, c_ptr, c_f_pointer
+
+    type(c_ptr), intent(in), value :: handle
+    integer(c_int), intent(in) :: mesh_dims(3)
+    real(c_double), intent(out) :: power_field(*)
+    real(c_double), intent(in) :: temperature_field(*)
+    integer(c_int), intent(in), value :: field_size
+    real(c_double), intent(in), value :: inner_tol
+    integer(c_int), intent(in), value :: max_inner_its
+    integer(c_int), intent(out) :: inner_its
+
+    type(b1_state), pointer :: state
+    real(c_double) :: source, change, scale, total_old, total_new
+    integer :: i
+
+    ! 场大小与创建时不一致时返回 inner_its = -1，由调用者报错 (可能在工作线程上，
+    ! 不能在这里终止进程)
+    ! a field size different from the one at creation returns inner_its = -1 for
+    ! the caller to report; this may run on a worker thread, so never stop here
+    call c_f_pointer(handle, state)
+    if (field_size /= state%field_size) then
+      inner_its = -1
+      return
+    end if
+    state%mesh_dims = mesh_dims
+
+    ! 源迭代：通量从上一次的解出发，温度反馈为多普勒型
+    ! source iteration started from the stored flux with a Doppler-like feedback
+    inner_its = 0
+    do while (inner_its < max_inner_its)
+      inner_its = inner_its + 1
+      change = 0.0_c_double
+      scale = 0.0_c_double
+      total_old = 0.0_c_double
+      total_new = 0.0_c_double
+      do i = 1, field_size
+        source = state%power_scale * (300.0_c_double + state%feedback * 300.0_c_double &
+                 / max(temperature_field(i), 1.0_c_double))
+        total_old = total_old + state%flux(i)
+        state%flux(i) = 0.5_c_double * (state%flux(i) + source)
+        total_new = total_new + state%flux(i)
+        change = max(change, abs(state%flux(i) - source))
+        scale = max(scale, abs(state%flux(i)))
+      end do
+      if (total_old > 0.0_c_double) state%keff = total_new / total_old
+      if (change <= inner_tol * max(scale, 1.0_c_double)) exit
+    end do
+
+    state%initialized = .true.
+    power_field(1:field_size) = state%flux(1:field_size)
+  end subroutine b1_solve
+
+  recursive function thermal_create(mesh_dims, field_size) result(handle) bind(C, name="thermal_create")
+    use iso_c_binding, only: c_int, c_ptr, c_loc
+
+    integer(c_int), intent(in) :: mesh_dims(3)
+    integer(c_int), intent(in), value :: field_size
+    type(c_ptr) :: handle
+
+    type(thermal_state), pointer :: state
+
+    allocate(state)
+    state%field_size = field_size
+    state%mesh_dims = mesh_dims
+    allocate(state%temperature(max(field_size, 1)))
+    state%temperature = 300.0_c_double
+    handle = c_loc(state)
+  end function thermal_create
+
+  recursive subroutine thermal_destroy(handle) bind(C, name="thermal_destroy")
+    use iso_c_binding, only: c_ptr, c_f_pointer, c_associated
+
+    type(c_ptr), intent(in), value :: handle
+    type(thermal_state), pointer :: state
+
+    if (.not. c_associated(handle)) return
+    call c_f_pointer(handle, state)
+    if (allocated(state%temperature)) deallocate(state%temperature)
+    deallocate(state)
+  end subroutine thermal_destroy
+
+  recursive subroutine thermal_reset(handle) bind(C, name="thermal_reset")
+    use iso_c_binding, only: c_ptr, c_f_pointer
+
+    type(c_ptr), intent(in), value :: handle
+    type(thermal_state), pointer :: state
+
+    call c_f_pointer(handle, state)
+    state%temperature = 300.0_c_double
+    state%initialized = .false.
+  end subroutine thermal_reset
+
+  ! active_channels 标记需要重新求解的通道 (字典序子块中 (i,j) 相同的一列点，
+  ! 共 mesh_dims(1)*mesh_dims(2) 个)；其余通道保留状态中上一次的温度。
+  ! 尚未求解过的状态忽略标记。
+  ! active_channels marks the channels (the columns of points sharing (i,j),
+  ! mesh_dims(1)*mesh_dims(2) of them) to solve again; the others keep the
+  ! temperature stored in the state. A state never solved ignores the mask.
+  recursive subroutine thermal_solve(handle, mesh_dims, power_field, temperature_field, field_size, &
+                           active_channels, inner_tol, max_inner_its, inner_its) &
+                           bind(C, name="thermal_solve")
+    use iso_c_binding, only: c_int, c_double, c_ptr, c_f_pointer
+
+    type(c_ptr), intent(in), value :: handle
+    integer(c_int), intent(in) :: mesh_dims(3)
+    real(c_double), intent(in) :: power_field(*)
+    real(c_double), intent(out) :: temperature_field(*)
+    integer(c_int), intent(in), value :: field_size
+    integer(c_int), intent(in) :: active_channels(*)
+    real(c_double), intent(in), value :: inner_tol
+    integer(c_int), intent(in), value :: max_inner_its
+    integer(c_int), intent(out) :: inner_its
+
+    type(thermal_state), pointer :: state
+    real(c_double) :: target, change, scale
+    integer :: i, n_channels
+    logical, allocatable :: active(:)
+
+    ! 场大小不一致时返回 inner_its = -1 (见 b1_solve)
+    call c_f_pointer(handle, state)
+    if (field_size /= state%field_size) then
+      inner_its = -1
+      return
+    end if
+    state%mesh_dims = mesh_dims
+
+    n_channels = max(mesh_dims(1) * mesh_dims(2), 1)
+    allocate(active(field_size))
+    do i = 1, field_size
+      active(i) = .not. state%initialized .or. active_channels(mod(i - 1, n_channels) + 1) /= 0
+    end do
+
+    ! 简单的热工模型：温度从上一次的解出发松弛到与功率成正比的平衡温度
+    ! simple model: the temperature relaxes from the stored solution towards
+    ! an equilibrium proportional to the power
+    inner_its = 0
+    do while (inner_its < max_inner_its .and. any(active))
+      inner_its = inner_its + 1
+      change = 0.0_c_double
+      scale = 0.0_c_double
+      do i = 1, field_size
+        if (.not. active(i)) cycle
+        target = 300.0_c_double + 0.01_c_double * power_field(i)
+        state%temperature(i) = 0.5_c_double * (state%temperature(i) + target)
+        change = max(change, abs(state%temperature(i) - target))
+        scale = max(scale, abs(state%temperature(i)))
+      end do
+      if (change <= inner_tol * max(scale, 1.0_c_double)) exit
+    end do
+
+    state%initialized = .true.
+    temperature_field(1:field_size) = state%temperature(1:field_size)
+  end subroutine thermal_solve
+
+  !--------------------------------------------------------------!
+  ! 批量求解接口 (Batched solver interface)                      !
+  !                                                              !
+  ! 一个进程上的所有实例的场按 offsets 连续存放，一次调用求解， !
+  ! 并返回每个实例的内迭代次数和耗时，供负载均衡使用。          !
+  ! The fields of all instances on a rank are stored back to     !
+  ! back (instance n owns offsets(n)+1 .. offsets(n+1)) and are  !
+  ! solved in one call; the inner iterations and wall time of    !
+  ! every instance are returned for load balancing.              !
+  ! 实例的 inner_its 为负表示该实例的求解被拒绝。                !
+  ! A negative inner_its marks an instance whose solve failed.   !
+  !--------------------------------------------------------------!
+
+  recursive subroutine b1_solve_batch(n_instances, handles, mesh_dims, offsets, power_field, &
+                            temperature_field, inner_tol, max_inner_its, inner_its, seconds) &
+                            bind(C, name="b1_solve_batch")
+    use iso_c_binding, only: c_int, c_double, c_ptr
+
+    integer(c_int), intent(in), value :: n_instances
+    type(c_ptr), intent(in) :: handles(n_instances)
+    integer(c_int), intent(in) :: mesh_dims(3, n_instances)
+    integer(c_int), intent(in) :: offsets(n_instances + 1)
+    real(c_double), intent(out) :: power_field(*)
+    real(c_double), intent(in) :: temperature_field(*)
+    real(c_double), intent(in), value :: inner_tol
+    integer(c_int), intent(in), value :: max_inner_its
+    integer(c_int), intent(out) :: inner_its(n_instances)
+    real(c_double), intent(out) :: seconds(n_instances)
+
+    integer :: n, first, last
+    integer(8) :: count_start, count_end, count_rate
+
+    do n = 1, n_instances
+      first = offsets(n) + 1
+      last = offsets(n + 1)
+      call system_clock(count_start, count_rate)
+      call b1_solve(handles(n), mesh_dims(:, n), power_field(first:last), &
+                    temperature_field(first:last), last - first + 1, inner_tol, &
+                    max_inner_its, inner_its(n))
+      call system_clock(count_end)
+      seconds(n) = real(count_end - count_start, c_double) / real(max(count_rate, 1_8), c_double)
+    end do
+  end subroutine b1_solve_batch
+
+  ! 实例 n 的通道标记为 active_channels(channel_offsets(n)+1 .. channel_offsets(n+1))
+  ! the channel mask of instance n is active_channels(channel_offsets(n)+1 .. channel_offsets(n+1))
+  recursive subroutine thermal_solve_batch(n_instances, handles, mesh_dims, offsets, power_field, &
+                                 temperature_field, channel_offsets, active_channels, inner_tol, &
+                                 max_inner_its, inner_its, seconds) &
+                                 bind(C, name="thermal_solve_batch")
+    use iso_c_binding, only: c_int, c_double, c_ptr
+
+    integer(c_int), intent(in), value :: n_instances
+    type(c_ptr), intent(in) :: handles(n_instances)
+    integer(c_int), intent(in) :: mesh_dims(3, n_instances)
+    integer(c_int), intent(in) :: offsets(n_instances + 1)
+    real(c_double), intent(in) :: power_field(*)
+    real(c_double), intent(out) :: temperature_field(*)
+    integer(c_int), intent(in) :: channel_offsets(n_instances + 1)
+    integer(c_int), intent(in) :: active_channels(*)
+    real(c_double), intent(in), value :: inner_tol
+    integer(c_int), intent(in), value :: max_inner_its
+    integer(c_int), intent(out) :: inner_its(n_instances)
+    real(c_double), intent(out) :: seconds(n_instances)
+
+    integer :: n, first, last
+    integer(8) :: count_start, count_end, count_rate
+
+    do n = 1, n_instances
+      first = offsets(n) + 1
+      last = offsets(n + 1)
+      call system_clock(count_start, count_rate)
+      call thermal_solve(handles(n), mesh_dims(:, n), power_field(first:last), &
+                         temperature_field(first:last), last - first + 1, &
+                         active_channels(channel_offsets(n) + 1), inner_tol, &
+                         max_inner_its, inner_its(n))
+      call system_clock(count_end)
+      seconds(n) = real(count_end - count_start, c_double) / real(max(count_rate, 1_8), c_double)
+    end do
+  end subroutine thermal_solve_batch
+
+  !--------------------------------------------------------------!
+  ! 求解器状态的保存与恢复 (Solver state checkpointing)          !
+  !                                                              !
+  ! xxx_state_size 返回状态的字节数，xxx_save_state 把状态写入   !
+  ! 调用者提供的缓冲区，xxx_load_state 从缓冲区恢复并返回 0      !
+  ! (大小或网格不一致时返回 1)。缓冲区对 C++ 端是不透明的，      !
+  ! 内容为 real(c_double) 数组:                                  !
+  !   b1:      field_size, mesh_dims(3), initialized, keff, flux !
+  !   thermal: field_size, mesh_dims(3), initialized, temperature!
+  !   (initialized 为 0 或 1 / initialized is 0 or 1)            !
+  ! xxx_state_size gives the size of the state in bytes,         !
+  ! xxx_save_state writes it to a caller-provided buffer and     !
+  ! xxx_load_state restores it, returning 0 (or 1 when the size  !
+  ! or mesh does not match). The buffer is opaque to C++.        !
+  !--------------------------------------------------------------!
+
+  recursive function b1_state_size(handle) result(nbytes) bind(C, name="b1_state_size")
+    use iso_c_binding, only: c_ptr, c_size_t, c_f_pointer
+
+    type(c_ptr), intent(in), value :: handle
+    integer(c_size_t) :: nbytes
+    type(b1_state), pointer :: state
+
+    call c_f_pointer(handle, state)
+    nbytes = int(6 + size(state%flux), c_size_t) * c_sizeof(1.0_c_double)
+  end function b1_state_size
+
+  recursive subroutine b1_save_state(handle, buffer, nbytes) bind(C, name="b1_save_state")
+    use iso_c_binding, only: c_ptr, c_size_t, c_double, c_f_pointer
+
+    type(c_ptr), intent(in), value :: handle
+    type(c_ptr), intent(in), value :: buffer
+    integer(c_size_t), intent(in), value :: nbytes
+    type(b1_state), pointer :: state
+    real(c_double), pointer :: blob(:)
+
+    call c_f_pointer(handle, state)
+    call c_f_pointer(buffer, blob, [nbytes / c_sizeof(1.0_c_double)])
+    blob(1) = real(state%field_size, c_double)
+    blob(2:4) = real(state%mesh_dims, c_double)
+    blob(5) = merge(1.0_c_double, 0.0_c_double, state%initialized)
+    blob(6) = state%keff
+    blob(7:) = state%flux
+  end subroutine b1_save_state
+
+  recursive function b1_load_state(handle, buffer, nbytes) result(status) bind(C, name="b1_load_state")
+    use iso_c_binding, only: c_ptr, c_size_t, c_double, c_int, c_f_pointer
+
+    type(c_ptr), intent(in), value :: handle
+    type(c_ptr), intent(in), value :: buffer
+    integer(c_size_t), intent(in), value :: nbytes
+    integer(c_int) :: status
+    type(b1_state), pointer :: state
+    real(c_double), pointer :: blob(:)
+
+    call c_f_pointer(handle, state)
+    status = 1
+    if (nbytes /= b1_state_size(handle)) return
+    call c_f_pointer(buffer, blob, [nbytes / c_sizeof(1.0_c_double)])
+    if (nint(blob(1)) /= state%field_size .or. any(nint(blob(2:4)) /= state%mesh_dims)) return
+
+    state%initialized = blob(5) > 0.5_c_double
+    state%keff = blob(6)
+    state%flux = blob(7:)
+    status = 0
+  end function b1_load_state
+
+  recursive function thermal_state_size(handle) result(nbytes) bind(C, name="thermal_state_size")
+    use iso_c_binding, only: c_ptr, c_size_t, c_f_pointer
+
+    type(c_ptr), intent(in), value :: handle
+    integer(c_size_t) :: nbytes
+    type(thermal_state), pointer :: state
+
+    call c_f_pointer(handle, state)
+    nbytes = int(5 + size(state%temperature), c_size_t) * c_sizeof(1.0_c_double)
+  end function thermal_state_size
+
+  recursive subroutine thermal_save_state(handle, buffer, nbytes) bind(C, name="thermal_save_state")
+    use iso_c_binding, only: c_ptr, c_size_t, c_double, c_f_pointer
+
+    type(c_ptr), intent(in), value :: handle
+    type(c_ptr), intent(in), value :: buffer
+    integer(c_size_t), intent(in), value :: nbytes
+    type(thermal_state), pointer :: state
+    real(c_double), pointer :: blob(:)
+
+    call c_f_pointer(handle, state)
+    call c_f_pointer(buffer, blob, [nbytes / c_sizeof(1.0_c_double)])
+    blob(1) = real(state%field_size, c_double)
+    blob(2:4) = real(state%mesh_dims, c_double)
+    blob(5) = merge(1.0_c_double, 0.0_c_double, state%initialized)
+    blob(6:) = state%temperature
+  end subroutine thermal_save_state
+
+  recursive function thermal_load_state(handle, buffer, nbytes) result(status) &
+                                        bind(C, name="thermal_load_state")
+    use iso_c_binding, only: c_ptr, c_size_t, c_double, c_int, c_f_pointer
+
+    type(c_ptr), intent(in), value :: handle
+    type(c_ptr), intent(in), value :: buffer
+    integer(c_size_t), intent(in), value :: nbytes
+    integer(c_int) :: status
+    type(thermal_state), pointer :: state
+    real(c_double), pointer :: blob(:)
+
+    call c_f_pointer(handle, state)
+    status = 1
+    if (nbytes /= thermal_state_size(handle)) return
+    call c_f_pointer(buffer, blob, [nbytes / c_sizeof(1.0_c_double)])
+    if (nint(blob(1)) /= state%field_size .or. any(nint(blob(2:4)) /= state%mesh_dims)) return
+
+    state%initialized = blob(5) > 0.5_c_double
+    state%temperature = blob(6:)
+    status = 0
+  end function thermal_load_state
+
+end module
@@ -0,0 +1,107 @@
+# 4 个耦合燃耗步，每 2 步输出一次；测试规格通过命令行参数切换为仅中子学
+# (预估步/校正步)、JACOBI 耦合格式，或写出检查点并从中重启
+# Four coupled burnup steps with outputs every second step; the test spec
+# switches to neutronics only (predictor/corrector), to the JACOBI coupling
+# scheme, or to writing checkpoints and restarting from them through command
+# line arguments.
+[Mesh]
+  [gmg]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 4
+    ny = 4
+    nz = 4
+  []
+[]
+
+[UserObjects]
+  [field_channel]
+    type = ReactorFieldChannel
+  []
+[]
+
+[MultiApps]
+  [neutronics]
+    type = NeutronicsMultiApp
+    app_type = MooseprojectsApp
+    input_files = 'neutronics_sub.i'
+    mesh_dims = '5 5 5'
+    power_var_name = power_density
+    temperature_var_name = temperature
+    field_channel = field_channel
+    execute_on = 'NEUTRONIC PRENEUTRONIC CORNEUTRONIC'
+  []
+
+  [thermal]
+    type = ThermalMultiApp
+    app_type = MooseprojectsApp
+    input_files = 'thermal_sub.i'
+    mesh_dims = '5 5 5'
+    power_var_name = power_density
+    temperature_var_name = temperature
+    field_channel = field_channel
+    execute_on = 'THERMAL'
+  []
+[]
+
+[Transfers]
+  [from_neutronics]
+    type = ReactorTransfer
+    from_multi_app = neutronics
+    source_variable = power_density
+    variable = power_density
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[Variables]
+  [dummy]
+  []
+[]
+
+[AuxVariables]
+  [power_density]
+  []
+  [temperature]
+  []
+[]
+
+[Kernels]
+  [dummy]
+    type = Diffusion
+    variable = dummy
+  []
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = BurnupExecutioner
+  calc_type = COUPLED
+  max_burn_steps = 4
+  fixed_point_max_its = 5
+  fixed_point_min_its = 2
+  relaxation_type = AITKEN
+  relaxation_factor = 0.7
+  field_channel = field_channel
+  output_interval = 2
+  log_level = SUMMARY
+[]
+
+[Postprocessors]
+  [avg_power]
+    type = ElementAverageValue
+    variable = power_density
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    execute_on = 'TIMESTEP_END'
+  []
+[]
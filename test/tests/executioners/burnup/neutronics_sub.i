@@ -0,0 +1,39 @@
+# 中子学子应用：温度为输入，功率由 b1 求解器写出
+[Mesh]
+  [gmg]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 4
+    ny = 4
+    nz = 4
+  []
+  # 按 z 方向分块分区，多进程时场仍按字典序子块交给Fortran
+  [Partitioner]
+    type = StructuredSlabPartitioner
+  []
+[]
+
+[Variables]
+  [temperature]
+  []
+[]
+
+[AuxVariables]
+  [power_density]
+  []
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1.0
+[]
+
+[Outputs]
+  console = false
+[]
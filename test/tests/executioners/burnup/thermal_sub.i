@@ -0,0 +1,39 @@
+# 热工子应用：功率为输入，温度由 thermal 求解器写出
+[Mesh]
+  [gmg]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 4
+    ny = 4
+    nz = 4
+  []
+  # 按 z 方向分块分区，多进程时场仍按字典序子块交给Fortran
+  [Partitioner]
+    type = StructuredSlabPartitioner
+  []
+[]
+
+[Variables]
+  [power_density]
+  []
+[]
+
+[AuxVariables]
+  [temperature]
+  []
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1.0
+[]
+
+[Outputs]
+  console = false
+[]
@@ -0,0 +1,95 @@
+# 两个耦合算例共用主应用网格，每个燃耗步的 Fortran 求解批量完成；
+# 两个算例的功率比例、温度反馈系数和松弛因子各不相同
+# Two coupled cases sharing the parent mesh, with batched Fortran solves; the
+# cases differ in power scale, temperature feedback and relaxation factor.
+[Mesh]
+  [gmg]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 4
+    ny = 4
+    nz = 4
+  []
+[]
+
+[UserObjects]
+  [field_channel]
+    type = ReactorFieldChannel
+  []
+[]
+
+[MultiApps]
+  [neutronics]
+    type = NeutronicsMultiApp
+    app_type = MooseprojectsApp
+    input_files = 'lean_subapp.i'
+    positions = '0 0 0  0 0 0'
+    use_parent_mesh = true
+    mesh_dims = '5 5 5'
+    solver_threads = 2
+    power_var_name = power_density
+    temperature_var_name = temperature
+    field_channel = field_channel
+    power_scales = '1.0 1.1'
+    feedback_coefficients = '10 12'
+    execute_on = 'NEUTRONIC PRENEUTRONIC CORNEUTRONIC'
+  []
+
+  [thermal]
+    type = ThermalMultiApp
+    app_type = MooseprojectsApp
+    input_files = 'lean_subapp.i'
+    positions = '0 0 0  0 0 0'
+    use_parent_mesh = true
+    mesh_dims = '5 5 5'
+    solver_threads = 2
+    power_var_name = power_density
+    temperature_var_name = temperature
+    field_channel = field_channel
+    execute_on = 'THERMAL'
+  []
+[]
+
+[Variables]
+  [dummy]
+  []
+[]
+
+[AuxVariables]
+  [power_density]
+  []
+  [temperature]
+  []
+[]
+
+[Kernels]
+  [dummy]
+    type = Diffusion
+    variable = dummy
+  []
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = EnsembleExecutioner
+  calc_type = COUPLED
+  max_burn_steps = 3
+  fixed_point_max_its = 15
+  fixed_point_min_its = 2
+  relaxation_type = AITKEN
+  relaxation_factor = 0.7
+  field_channel = field_channel
+  power_level = 3000
+  heavy_metal_mass = 80
+  case_relaxation_factors = '0.9 0.6'
+  case_log = ensemble_cases.csv
+  log_level = SUMMARY
+[]
+
+[Outputs]
+  console = true
+[]
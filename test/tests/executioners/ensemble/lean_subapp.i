@@ -0,0 +1,29 @@
+# 共享主应用网格时的最小子应用 (use_parent_mesh = true)
+# 场存放在主应用的变量中，求解由 Fortran 完成；MultiApp 仍然需要为每个实例
+# 构造一个子应用，这里只保留一个单元的网格，没有变量、系统求解和输出
+# Minimal sub-app for use_parent_mesh = true: the fields live in the parent
+# variables and the Fortran kernels do the solve, so the app MOOSE builds for
+# every instance only carries a one-element mesh.
+[Mesh]
+  [gmg]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 1
+  []
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1.0
+[]
+
+[Outputs]
+  console = false
+[]
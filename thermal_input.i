@@ -8,6 +8,10 @@
     ny = 4
     nz = 4
   []
+  # 按 z 方向分块分区，多进程时场仍按字典序子块交给Fortran
+  [Partitioner]
+    type = StructuredSlabPartitioner
+  []
 []
 
 [Variables]
@@ -37,6 +41,8 @@
 []
 
 [Outputs]
-  exodus = true
+  # 每个燃耗步的子应用网格写出会阻塞求解；功率场和温度场的历史
+  # 由主应用的 field_history 在后台写出
+  exodus = false
   console = true
 []
\ No newline at end of file